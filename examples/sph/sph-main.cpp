@@ -313,6 +313,8 @@ int main() {
     dataLayouts.erase(dataLayouts.find(autopas::DataLayoutOption::cuda));
   }
   sphSystem.setAllowedDataLayouts(dataLayouts);
+  // density and hydro force functor differ a lot in their arithmetic intensity
+  sphSystem.setTuneFunctorsIndependently(true);
 
   sphSystem.init();
 
@@ -7,17 +7,24 @@
 #pragma once
 
 #include <iostream>
+#include <limits>
+#include <map>
 #include <memory>
 #include <set>
 #include <type_traits>
+#include <vector>
 
 #include "autopas/LogicHandler.h"
+#include "autopas/options/TelemetryFormatOption.h"
 #include "autopas/options/TuningStrategyOption.h"
 #include "autopas/selectors/AutoTuner.h"
+#include "autopas/selectors/RuleBasedPruning.h"
 #include "autopas/selectors/tuningStrategy/ActiveHarmony.h"
 #include "autopas/selectors/tuningStrategy/BayesianSearch.h"
+#include "autopas/selectors/tuningStrategy/CostModelSearch.h"
 #include "autopas/selectors/tuningStrategy/FullSearch.h"
 #include "autopas/selectors/tuningStrategy/RandomSearch.h"
+#include "autopas/selectors/tuningStrategy/SuccessiveHalving.h"
 #include "autopas/utils/NumberSet.h"
 
 namespace autopas {
@@ -68,12 +75,18 @@ class AutoPas {
       : _boxMin{0, 0, 0},
         _boxMax{0, 0, 0},
         _cutoff(1.),
-        _verletSkin(0.2),
-        _verletRebuildFrequency(20),
-        _verletClusterSize(64),
+        _allowedVerletSkins(std::make_unique<NumberSetFinite<double>>(std::set<double>({0.2}))),
+        _allowedVerletRebuildFrequencies({20}),
+        _allowedVerletClusterSizes({4}),
         _tuningInterval(5000),
         _numSamples(3),
+        _maxNumSamples(3),
+        _relativeConfidenceWidth(std::numeric_limits<double>::infinity()),
+        _earlyStoppingFactor(std::numeric_limits<double>::infinity()),
+        _driftThreshold(std::numeric_limits<double>::infinity()),
+        _driftWindowSize(10),
         _maxEvidence(10),
+        _successiveHalvingReductionFactor(2.),
         _acquisitionFunctionOption(AcquisitionFunctionOption::lowerConfidenceBound),
         _tuningStrategyOption(TuningStrategyOption::fullSearch),
         _selectorStrategy(SelectorStrategyOption::fastestAbs),
@@ -81,7 +94,10 @@ class AutoPas {
         _allowedTraversals(TraversalOption::getAllOptions()),
         _allowedDataLayouts(DataLayoutOption::getAllOptions()),
         _allowedNewton3Options(Newton3Option::getAllOptions()),
-        _allowedCellSizeFactors(std::make_unique<NumberSetFinite<double>>(std::set<double>({1.}))) {
+        _allowedCellSizeFactors(std::make_unique<NumberSetFinite<double>>(std::set<double>({1.}))),
+        _allowedNumThreads({0}),
+        _allowedScheduleOptions({ScheduleOption::dynamicSchedule}),
+        _allowedScheduleChunkSizes({1}) {
     // count the number of autopas instances. This is needed to ensure that the autopas
     // logger is not unregistered while other instances are still using it.
     _instanceCounter++;
@@ -123,10 +139,12 @@ class AutoPas {
    */
   void init() {
     _autoTuner = std::make_unique<autopas::AutoTuner<Particle, ParticleCell>>(
-        _boxMin, _boxMax, _cutoff, _verletSkin, _verletClusterSize, std::move(generateTuningStrategy()),
-        _selectorStrategy, _tuningInterval, _numSamples);
-    _logicHandler =
-        std::make_unique<autopas::LogicHandler<Particle, ParticleCell>>(*(_autoTuner.get()), _verletRebuildFrequency);
+        _boxMin, _boxMax, _cutoff, std::move(generateTuningStrategy()), _selectorStrategy, _tuningInterval, _numSamples,
+        _tuningDatabaseFile, _earlyStoppingFactor, _driftThreshold, _driftWindowSize, _pruningRules, _maxNumSamples,
+        _relativeConfidenceWidth, _tuningRecordFile, _tuneFunctorsIndependently, _proxyDomainFraction,
+        _numProxyConfirmations, _usePerformanceCounters, _incrementalRebuildThreshold, _useCompactNeighborLists);
+    _logicHandler = std::make_unique<autopas::LogicHandler<Particle, ParticleCell>>(
+        *(_autoTuner.get()), _telemetryFile, _telemetryFormat, _rebuildOnDisplacement);
   }
 
   /**
@@ -362,41 +380,163 @@ class AutoPas {
 
   /**
    * Get length added to the cutoff for the Verlet lists' skin.
+   * If multiple skins are allowed this is the largest one, so halo regions should be at least cutoff plus this wide.
    * @return
    */
-  double getVerletSkin() const { return _verletSkin; }
+  double getVerletSkin() const { return _allowedVerletSkins->getMax(); }
 
   /**
-   * Set length added to the cutoff for the Verlet lists' skin.
+   * Set allowed Verlet skins to one element.
    * @param verletSkin
    */
-  void setVerletSkin(double verletSkin) { AutoPas::_verletSkin = verletSkin; }
+  void setVerletSkin(double verletSkin) {
+    if (verletSkin < 0.0) {
+      AutoPasLog(error, "verlet skin < 0.0: {}", verletSkin);
+      utils::ExceptionHandler::exception("Error: verlet skin < 0.0!");
+    }
+    AutoPas::_allowedVerletSkins = std::make_unique<NumberSetFinite<double>>(std::set<double>{verletSkin});
+  }
+
+  /**
+   * Get allowed Verlet skins.
+   * @return
+   */
+  const NumberSet<double> &getAllowedVerletSkins() const { return *_allowedVerletSkins; }
+
+  /**
+   * Set allowed Verlet skins.
+   * Every combination of allowed skins and rebuild frequencies has to be valid for the simulation, i.e. particles must
+   * not move more than skin/2 between two rebuilds. The tuner only judges them by their performance.
+   * @param allowedVerletSkins
+   */
+  void setAllowedVerletSkins(const NumberSet<double> &allowedVerletSkins) {
+    if (allowedVerletSkins.getMin() < 0.0) {
+      AutoPasLog(error, "verlet skin < 0.0");
+      utils::ExceptionHandler::exception("Error: verlet skin < 0.0!");
+    }
+    AutoPas::_allowedVerletSkins = std::move(allowedVerletSkins.clone());
+  }
 
   /**
    * Get Verlet rebuild frequency.
+   * If multiple frequencies are allowed this is the smallest one.
    * @return
    */
-  unsigned int getVerletRebuildFrequency() const { return _verletRebuildFrequency; }
+  unsigned int getVerletRebuildFrequency() const { return *_allowedVerletRebuildFrequencies.begin(); }
 
   /**
-   * Set Verlet rebuild frequency.
+   * Set allowed Verlet rebuild frequencies to one element.
    * @param verletRebuildFrequency
    */
   void setVerletRebuildFrequency(unsigned int verletRebuildFrequency) {
-    AutoPas::_verletRebuildFrequency = verletRebuildFrequency;
+    setAllowedVerletRebuildFrequencies({verletRebuildFrequency});
+  }
+
+  /**
+   * Get whether the neighbor lists are rebuilt as soon as particles moved too far.
+   * @return
+   */
+  bool getRebuildOnDisplacement() const { return _rebuildOnDisplacement; }
+
+  /**
+   * Set whether the neighbor lists are rebuilt as soon as twice the maximal displacement of a particle since the last
+   * rebuild exceeds the skin. The Verlet rebuild frequency then is only an upper bound, so it can be chosen large.
+   * Checking the displacement costs one pass over all particles per iteration.
+   * @note Not to be combined with incremental rebuilds, which reduce the displacement the lists tolerate.
+   * @note With MPI the decision is local to each process, so halo particles have to be exchanged in every iteration.
+   * @param rebuildOnDisplacement
+   */
+  void setRebuildOnDisplacement(bool rebuildOnDisplacement) { AutoPas::_rebuildOnDisplacement = rebuildOnDisplacement; }
+
+  /**
+   * Get the fraction of the skin below which VerletLists keep the lists of calm cells on a rebuild.
+   * @return
+   */
+  double getIncrementalRebuildThreshold() const { return _incrementalRebuildThreshold; }
+
+  /**
+   * Set the fraction of the skin below which VerletLists keep the lists of calm cells on a rebuild.
+   * A cell is calm if it contains the same particles as at the previous rebuild and none of them moved further than
+   * threshold * skin since its lists were generated. Only the lists of particles in cells that are not calm or adjacent
+   * to such a cell are regenerated, so the cost of a rebuild scales with the moving part of the domain.
+   * Kept lists tolerate less motion until the next rebuild: the rebuild frequency has to be chosen such that no
+   * particle moves further than (1 / 2 - 2 * threshold) * skin in between. Zero disables incremental rebuilds.
+   * @param incrementalRebuildThreshold In [0, 0.25).
+   */
+  void setIncrementalRebuildThreshold(double incrementalRebuildThreshold) {
+    if (incrementalRebuildThreshold < 0. or incrementalRebuildThreshold >= .25) {
+      AutoPasLog(error, "Incremental rebuild threshold not in [0, 0.25): {}", incrementalRebuildThreshold);
+      utils::ExceptionHandler::exception("Error: Incremental rebuild threshold not in [0, 0.25)!");
+    }
+    AutoPas::_incrementalRebuildThreshold = incrementalRebuildThreshold;
+  }
+
+  /**
+   * Get whether VerletLists store their neighbor lists with 32 bit indices.
+   * @return
+   */
+  bool getUseCompactNeighborLists() const { return _useCompactNeighborLists; }
+
+  /**
+   * Set whether VerletLists store their neighbor lists with 32 bit instead of 64 bit indices. This halves the memory
+   * traffic of the lists in the traversal. The SoA data layout then requires functors that implement the SoAFunctor
+   * for CSRNeighborLists<uint32_t>.
+   * @param useCompactNeighborLists
+   */
+  void setUseCompactNeighborLists(bool useCompactNeighborLists) {
+    AutoPas::_useCompactNeighborLists = useCompactNeighborLists;
+  }
+
+  /**
+   * Get allowed Verlet rebuild frequencies.
+   * @return
+   */
+  const std::set<unsigned int> &getAllowedVerletRebuildFrequencies() const { return _allowedVerletRebuildFrequencies; }
+
+  /**
+   * Set allowed Verlet rebuild frequencies.
+   * @see setAllowedVerletSkins()
+   * @param allowedVerletRebuildFrequencies
+   */
+  void setAllowedVerletRebuildFrequencies(const std::set<unsigned int> &allowedVerletRebuildFrequencies) {
+    if (allowedVerletRebuildFrequencies.empty() or *allowedVerletRebuildFrequencies.begin() == 0) {
+      AutoPasLog(error, "verlet rebuild frequency == 0 or none given");
+      utils::ExceptionHandler::exception("Error: verlet rebuild frequency == 0 or none given!");
+    }
+    AutoPas::_allowedVerletRebuildFrequencies = allowedVerletRebuildFrequencies;
   }
 
   /**
    * Get Verlet cluster size.
+   * If multiple cluster sizes are allowed this is the smallest one.
    * @return
    */
-  unsigned int getVerletClusterSize() const { return _verletClusterSize; }
+  unsigned int getVerletClusterSize() const { return *_allowedVerletClusterSizes.begin(); }
 
   /**
-   * Set Verlet cluster size.
+   * Set allowed Verlet cluster sizes to one element.
    * @param verletClusterSize
    */
-  void setVerletClusterSize(unsigned int verletClusterSize) { AutoPas::_verletClusterSize = verletClusterSize; }
+  void setVerletClusterSize(unsigned int verletClusterSize) { setAllowedVerletClusterSizes({verletClusterSize}); }
+
+  /**
+   * Get allowed Verlet cluster sizes.
+   * @return
+   */
+  const std::set<unsigned int> &getAllowedVerletClusterSizes() const { return _allowedVerletClusterSizes; }
+
+  /**
+   * Set allowed Verlet cluster sizes.
+   * The cluster size only affects the containers verletClusterLists and verletClusterCells.
+   * @param allowedVerletClusterSizes
+   */
+  void setAllowedVerletClusterSizes(const std::set<unsigned int> &allowedVerletClusterSizes) {
+    if (allowedVerletClusterSizes.empty() or *allowedVerletClusterSizes.begin() == 0) {
+      AutoPasLog(error, "verlet cluster size == 0 or none given");
+      utils::ExceptionHandler::exception("Error: verlet cluster size == 0 or none given!");
+    }
+    AutoPas::_allowedVerletClusterSizes = allowedVerletClusterSizes;
+  }
 
   /**
    * Get tuning interval.
@@ -422,6 +562,255 @@ class AutoPas {
    */
   void setNumSamples(unsigned int numSamples) { AutoPas::_numSamples = numSamples; }
 
+  /**
+   * Get the maximal number of samples taken per configuration if adaptive sampling is enabled.
+   * @return
+   */
+  unsigned int getMaxNumSamples() const { return _maxNumSamples; }
+
+  /**
+   * Set the maximal number of samples taken per configuration if adaptive sampling is enabled.
+   * Values below the number of samples are raised to it.
+   * @param maxNumSamples
+   */
+  void setMaxNumSamples(unsigned int maxNumSamples) { AutoPas::_maxNumSamples = maxNumSamples; }
+
+  /**
+   * Get the relative width of the confidence interval up to which configurations are sampled again.
+   * @return
+   */
+  double getRelativeConfidenceWidth() const { return _relativeConfidenceWidth; }
+
+  /**
+   * Set the relative width of the confidence interval up to which configurations are sampled again.
+   * After the number of samples set via setNumSamples() is taken, further samples are taken until the half width of
+   * the 95% confidence interval of their mean relative to the mean is below this value or the maximal number of
+   * samples is reached. Outliers are rejected before the samples are reduced.
+   * Infinity disables adaptive sampling.
+   * @param relativeConfidenceWidth
+   */
+  void setRelativeConfidenceWidth(double relativeConfidenceWidth) {
+    if (relativeConfidenceWidth <= 0.) {
+      AutoPasLog(error, "Relative confidence width <= 0.0: {}", relativeConfidenceWidth);
+      utils::ExceptionHandler::exception("Error: Relative confidence width <= 0.0!");
+    }
+    AutoPas::_relativeConfidenceWidth = relativeConfidenceWidth;
+  }
+
+  /**
+   * Get the factor by which the first sample of a configuration may exceed the fastest evidence of the current tuning
+   * phase before the configuration is discarded.
+   * @return
+   */
+  double getEarlyStoppingFactor() const { return _earlyStoppingFactor; }
+
+  /**
+   * Set the factor by which the first sample of a configuration may exceed the fastest evidence of the current tuning
+   * phase before the configuration is discarded without taking further samples.
+   * Infinity disables early stopping.
+   * @param earlyStoppingFactor
+   */
+  void setEarlyStoppingFactor(double earlyStoppingFactor) {
+    if (earlyStoppingFactor < 1.) {
+      AutoPasLog(error, "Early stopping factor < 1.0: {}", earlyStoppingFactor);
+      utils::ExceptionHandler::exception("Error: Early stopping factor < 1.0!");
+    }
+    AutoPas::_earlyStoppingFactor = earlyStoppingFactor;
+  }
+
+  /**
+   * Get the number of standard deviations the iteration time may drift before a tuning phase is started early.
+   * @return
+   */
+  double getDriftThreshold() const { return _driftThreshold; }
+
+  /**
+   * Set the number of standard deviations the iteration time of the selected configuration may drift from its time
+   * directly after the last tuning phase before a new tuning phase is started. The tuning interval then acts as the
+   * maximal interval between two tuning phases.
+   * Infinity disables drift detection.
+   * @param driftThreshold
+   */
+  void setDriftThreshold(double driftThreshold) {
+    if (driftThreshold <= 0.) {
+      AutoPasLog(error, "Drift threshold <= 0.0: {}", driftThreshold);
+      utils::ExceptionHandler::exception("Error: Drift threshold <= 0.0!");
+    }
+    AutoPas::_driftThreshold = driftThreshold;
+  }
+
+  /**
+   * Get the number of iterations used for the reference and the current time of the drift detection.
+   * @return
+   */
+  unsigned int getDriftWindowSize() const { return _driftWindowSize; }
+
+  /**
+   * Set the number of iterations used for the reference and the current time of the drift detection.
+   * @param driftWindowSize
+   */
+  void setDriftWindowSize(unsigned int driftWindowSize) {
+    if (driftWindowSize == 0) {
+      AutoPasLog(error, "Drift window size == 0");
+      utils::ExceptionHandler::exception("Error: Drift window size == 0!");
+    }
+    AutoPas::_driftWindowSize = driftWindowSize;
+  }
+
+  /**
+   * Get the rules used to exclude configurations from tuning phases.
+   * @return
+   */
+  const std::vector<PruningRule> &getPruningRules() const { return _pruningRules; }
+
+  /**
+   * Set the rules used to exclude configurations from tuning phases. Before every tuning phase statistics of the
+   * domain are collected and configurations matching a rule whose condition holds are not tested.
+   * RuleBasedPruning::getDefaultRules() provides rules for commonly known cases. By default no rules are used.
+   * @param pruningRules
+   */
+  void setPruningRules(const std::vector<PruningRule> &pruningRules) { AutoPas::_pruningRules = pruningRules; }
+
+  /**
+   * Get the file used to persist tuning results across runs.
+   * @return
+   */
+  const std::string &getTuningDatabaseFile() const { return _tuningDatabaseFile; }
+
+  /**
+   * Set the file used to persist tuning results across runs.
+   * If the file contains an optimum for the current scenario the first tuning phase is skipped.
+   * An empty string disables the tuning database.
+   * @param tuningDatabaseFile
+   */
+  void setTuningDatabaseFile(const std::string &tuningDatabaseFile) {
+    AutoPas::_tuningDatabaseFile = tuningDatabaseFile;
+  }
+
+  /**
+   * Get the file where all measurements of tuning phases are recorded.
+   * @return
+   */
+  const std::string &getTuningRecordFile() const { return _tuningRecordFile; }
+
+  /**
+   * Set the file where all measurements of tuning phases are recorded. The records can be replayed offline against
+   * any tuning strategy with the tuning-replay tool.
+   * An empty string disables recording.
+   * @param tuningRecordFile
+   */
+  void setTuningRecordFile(const std::string &tuningRecordFile) { AutoPas::_tuningRecordFile = tuningRecordFile; }
+
+  /**
+   * Get whether functor types select their traversal, data layout and newton 3 option independently.
+   * @return
+   */
+  bool getTuneFunctorsIndependently() const { return _tuneFunctorsIndependently; }
+
+  /**
+   * Set whether functor types select their traversal, data layout and newton 3 option independently.
+   * If enabled, only the first relevant functor type passed to iteratePairwise() drives the tuning strategy and selects
+   * the container. Every other relevant functor type tests all configurations that can share this container after each
+   * tuning phase and keeps its fastest one.
+   * @param tuneFunctorsIndependently
+   */
+  void setTuneFunctorsIndependently(bool tuneFunctorsIndependently) {
+    AutoPas::_tuneFunctorsIndependently = tuneFunctorsIndependently;
+  }
+
+  /**
+   * Get the fraction of the domain volume on which configurations are measured before they are sampled on the full
+   * domain.
+   * @return
+   */
+  double getProxyDomainFraction() const { return _proxyDomainFraction; }
+
+  /**
+   * Set the fraction of the domain volume on which configurations are measured before they are sampled on the full
+   * domain.
+   * If below one, every tuning phase first runs the tuning strategy on a copy of a centered subvolume of the domain
+   * with its halo. Only the fastest configurations there are sampled on the full domain, see
+   * setNumProxyConfirmations(). One disables proxy tuning.
+   * @param proxyDomainFraction
+   */
+  void setProxyDomainFraction(double proxyDomainFraction) {
+    if (proxyDomainFraction <= 0. or proxyDomainFraction > 1.) {
+      AutoPasLog(error, "Proxy domain fraction not in (0, 1]: {}", proxyDomainFraction);
+      utils::ExceptionHandler::exception("Error: Proxy domain fraction not in (0, 1]!");
+    }
+    AutoPas::_proxyDomainFraction = proxyDomainFraction;
+  }
+
+  /**
+   * Get the number of configurations of the proxy domain that are sampled on the full domain.
+   * @return
+   */
+  unsigned int getNumProxyConfirmations() const { return _numProxyConfirmations; }
+
+  /**
+   * Set the number of configurations of the proxy domain that are sampled on the full domain.
+   * @see setProxyDomainFraction()
+   * @param numProxyConfirmations
+   */
+  void setNumProxyConfirmations(unsigned int numProxyConfirmations) {
+    if (numProxyConfirmations == 0) {
+      AutoPasLog(error, "Number of proxy confirmations == 0");
+      utils::ExceptionHandler::exception("Error: Number of proxy confirmations == 0!");
+    }
+    AutoPas::_numProxyConfirmations = numProxyConfirmations;
+  }
+
+  /**
+   * Get whether hardware performance counters are read during tuning.
+   * @return
+   */
+  bool getUsePerformanceCounters() const { return _usePerformanceCounters; }
+
+  /**
+   * Set whether hardware performance counters (cycles, instructions, last level cache misses and flops where
+   * available) are read during tuning. They are logged and passed to the tuning strategy per configuration. If the
+   * counters can not be opened only times are measured.
+   * @param usePerformanceCounters
+   */
+  void setUsePerformanceCounters(bool usePerformanceCounters) {
+    AutoPas::_usePerformanceCounters = usePerformanceCounters;
+  }
+
+  /**
+   * Get the hardware performance counters of the last measurement of every configuration.
+   * Empty unless performance counters are enabled and available.
+   * @return
+   */
+  const std::map<Configuration, utils::PerformanceCounterValues> &getPerformanceCounterEvidence() const {
+    return _autoTuner->getPerformanceCounterEvidence();
+  }
+
+  /**
+   * Get the file where the telemetry of every iteration is written.
+   * @return
+   */
+  const std::string &getTelemetryFile() const { return _telemetryFile; }
+
+  /**
+   * Set the file where one record per iteratePairwise() call is written, holding the configuration, the times of the
+   * container update, neighbor list rebuild, SoA load, traversal and SoA extraction as well as the particle counts.
+   * Records are buffered and written by a background thread. Empty string disables telemetry.
+   * @param telemetryFile
+   */
+  void setTelemetryFile(const std::string &telemetryFile) { AutoPas::_telemetryFile = telemetryFile; }
+
+  /**
+   * Get the format of the telemetry file.
+   * @return
+   */
+  TelemetryFormatOption getTelemetryFormat() const { return _telemetryFormat; }
+
+  /**
+   * Set the format of the telemetry file.
+   * @param telemetryFormat
+   */
+  void setTelemetryFormat(TelemetryFormatOption telemetryFormat) { AutoPas::_telemetryFormat = telemetryFormat; }
+
   /**
    * Get maximum number of evidence for tuning
    * @return
@@ -434,6 +823,25 @@ class AutoPas {
    */
   void setMaxEvidence(unsigned int maxEvidence) { AutoPas::_maxEvidence = maxEvidence; }
 
+  /**
+   * Get the reduction factor of the successive halving tuning strategy.
+   * @return
+   */
+  double getSuccessiveHalvingReductionFactor() const { return _successiveHalvingReductionFactor; }
+
+  /**
+   * Set the reduction factor of the successive halving tuning strategy. After each round only the fastest
+   * 1/reductionFactor configurations are tested again.
+   * @param reductionFactor
+   */
+  void setSuccessiveHalvingReductionFactor(double reductionFactor) {
+    if (reductionFactor <= 1.) {
+      AutoPasLog(error, "Successive halving reduction factor <= 1.0: {}", reductionFactor);
+      utils::ExceptionHandler::exception("Error: Successive halving reduction factor <= 1.0!");
+    }
+    AutoPas::_successiveHalvingReductionFactor = reductionFactor;
+  }
+
   /**
    * Get acquisition function used for tuning
    * @return
@@ -446,6 +854,18 @@ class AutoPas {
    */
   void setAcquisitionFunction(AcquisitionFunctionOption acqFun) { AutoPas::_acquisitionFunctionOption = acqFun; }
 
+  /**
+   * Get whether the bayesian search starts from the estimates of a cost model.
+   * @return
+   */
+  bool getUseCostModelPrior() const { return _useCostModelPrior; }
+
+  /**
+   * Set whether the bayesian search starts from the estimates of a cost model instead of a flat prior.
+   * @param useCostModelPrior
+   */
+  void setUseCostModelPrior(bool useCostModelPrior) { AutoPas::_useCostModelPrior = useCostModelPrior; }
+
   /**
    * Get the selector configuration strategy.
    * @return
@@ -519,12 +939,76 @@ class AutoPas {
     AutoPas::_allowedNewton3Options = allowedNewton3Options;
   }
 
+  /**
+   * Get the list of allowed numbers of OpenMP threads.
+   * @return
+   */
+  const std::set<unsigned int> &getAllowedNumThreads() const { return _allowedNumThreads; }
+
+  /**
+   * Set the list of allowed numbers of OpenMP threads for the traversals.
+   * 0 stands for all available threads. Thread counts above the number of available threads are not applicable.
+   * @param allowedNumThreads
+   */
+  void setAllowedNumThreads(const std::set<unsigned int> &allowedNumThreads) {
+    if (allowedNumThreads.empty()) {
+      AutoPasLog(error, "no number of threads given");
+      utils::ExceptionHandler::exception("Error: no number of threads given!");
+    }
+    AutoPas::_allowedNumThreads = allowedNumThreads;
+  }
+
+  /**
+   * Get the list of allowed OpenMP schedule kinds.
+   * @return
+   */
+  const std::set<ScheduleOption> &getAllowedScheduleOptions() const { return _allowedScheduleOptions; }
+
+  /**
+   * Set the list of allowed OpenMP schedule kinds for the traversals.
+   * For possible schedule choices see AutoPas::ScheduleOption.
+   * @param allowedScheduleOptions
+   */
+  void setAllowedScheduleOptions(const std::set<ScheduleOption> &allowedScheduleOptions) {
+    AutoPas::_allowedScheduleOptions = allowedScheduleOptions;
+  }
+
+  /**
+   * Get the list of allowed OpenMP schedule chunk sizes.
+   * @return
+   */
+  const std::set<unsigned int> &getAllowedScheduleChunkSizes() const { return _allowedScheduleChunkSizes; }
+
+  /**
+   * Set the list of allowed OpenMP schedule chunk sizes for the traversals.
+   * 0 stands for the default chunk size of the schedule kind.
+   * @param allowedScheduleChunkSizes
+   */
+  void setAllowedScheduleChunkSizes(const std::set<unsigned int> &allowedScheduleChunkSizes) {
+    if (allowedScheduleChunkSizes.empty()) {
+      AutoPasLog(error, "no schedule chunk size given");
+      utils::ExceptionHandler::exception("Error: no schedule chunk size given!");
+    }
+    AutoPas::_allowedScheduleChunkSizes = allowedScheduleChunkSizes;
+  }
+
   /**
    * Getter for the currently selected configuration.
    * @return Configuration object currently used.
    */
   Configuration getCurrentConfig() const { return _autoTuner->getCurrentConfig(); }
 
+  /**
+   * Getter for the configuration the given functor type currently uses.
+   * This only differs from getCurrentConfig() if functors are tuned independently.
+   * @tparam Functor
+   * @return Configuration object currently used for the functor type.
+   */
+  template <class Functor>
+  Configuration getFunctorConfig() const {
+    return _autoTuner->template getFunctorConfig<Functor>();
+  }
+
   /**
    * Getter for the tuning strategy option.
    * @return
@@ -549,7 +1033,10 @@ class AutoPas {
     switch (static_cast<TuningStrategyOption>(_tuningStrategyOption)) {
       case TuningStrategyOption::randomSearch: {
         return std::make_unique<RandomSearch>(_allowedContainers, *_allowedCellSizeFactors, _allowedTraversals,
-                                              _allowedDataLayouts, _allowedNewton3Options, _maxEvidence);
+                                              _allowedDataLayouts, _allowedNewton3Options, *_allowedVerletSkins,
+                                              _allowedVerletRebuildFrequencies, _allowedNumThreads,
+                                              _allowedScheduleOptions, _allowedScheduleChunkSizes,
+                                              _allowedVerletClusterSizes, _maxEvidence);
       }
       case TuningStrategyOption::fullSearch: {
         if (not _allowedCellSizeFactors->isFinite()) {
@@ -557,20 +1044,74 @@ class AutoPas {
               "AutoPas::generateTuningStrategy: fullSearch can not handle infinite cellSizeFactors!");
           return nullptr;
         }
+        if (not _allowedVerletSkins->isFinite()) {
+          autopas::utils::ExceptionHandler::exception(
+              "AutoPas::generateTuningStrategy: fullSearch can not handle infinite verletSkins!");
+          return nullptr;
+        }
 
         return std::make_unique<FullSearch>(_allowedContainers, _allowedCellSizeFactors->getAll(), _allowedTraversals,
-                                            _allowedDataLayouts, _allowedNewton3Options);
+                                            _allowedDataLayouts, _allowedNewton3Options, _allowedVerletSkins->getAll(),
+                                            _allowedVerletRebuildFrequencies, _allowedNumThreads,
+                                            _allowedScheduleOptions, _allowedScheduleChunkSizes,
+                                            _allowedVerletClusterSizes);
       }
 
       case TuningStrategyOption::bayesianSearch: {
-        return std::make_unique<BayesianSearch>(_allowedContainers, *_allowedCellSizeFactors, _allowedTraversals,
-                                                _allowedDataLayouts, _allowedNewton3Options, _maxEvidence,
-                                                _acquisitionFunctionOption);
+        auto bayesianSearch = std::make_unique<BayesianSearch>(
+            _allowedContainers, *_allowedCellSizeFactors, _allowedTraversals, _allowedDataLayouts,
+            _allowedNewton3Options, *_allowedVerletSkins, _allowedVerletRebuildFrequencies, _allowedNumThreads,
+            _allowedScheduleOptions, _allowedScheduleChunkSizes, _allowedVerletClusterSizes, _maxEvidence,
+            _acquisitionFunctionOption);
+        bayesianSearch->setUseCostModel(_useCostModelPrior);
+        return bayesianSearch;
       }
 
       case TuningStrategyOption::activeHarmony: {
         return std::make_unique<ActiveHarmony>(_allowedContainers, *_allowedCellSizeFactors, _allowedTraversals,
-                                               _allowedDataLayouts, _allowedNewton3Options);
+                                               _allowedDataLayouts, _allowedNewton3Options, *_allowedVerletSkins,
+                                               _allowedVerletRebuildFrequencies, _allowedNumThreads,
+                                               _allowedScheduleOptions, _allowedScheduleChunkSizes,
+                                               _allowedVerletClusterSizes);
+      }
+
+      case TuningStrategyOption::successiveHalving: {
+        if (not _allowedCellSizeFactors->isFinite()) {
+          autopas::utils::ExceptionHandler::exception(
+              "AutoPas::generateTuningStrategy: successiveHalving can not handle infinite cellSizeFactors!");
+          return nullptr;
+        }
+        if (not _allowedVerletSkins->isFinite()) {
+          autopas::utils::ExceptionHandler::exception(
+              "AutoPas::generateTuningStrategy: successiveHalving can not handle infinite verletSkins!");
+          return nullptr;
+        }
+
+        return std::make_unique<SuccessiveHalving>(_allowedContainers, _allowedCellSizeFactors->getAll(),
+                                                   _allowedTraversals, _allowedDataLayouts, _allowedNewton3Options,
+                                                   _allowedVerletSkins->getAll(), _allowedVerletRebuildFrequencies,
+                                                   _allowedNumThreads, _allowedScheduleOptions,
+                                                   _allowedScheduleChunkSizes, _allowedVerletClusterSizes,
+                                                   _successiveHalvingReductionFactor);
+      }
+
+      case TuningStrategyOption::costModelSearch: {
+        if (not _allowedCellSizeFactors->isFinite()) {
+          autopas::utils::ExceptionHandler::exception(
+              "AutoPas::generateTuningStrategy: costModelSearch can not handle infinite cellSizeFactors!");
+          return nullptr;
+        }
+        if (not _allowedVerletSkins->isFinite()) {
+          autopas::utils::ExceptionHandler::exception(
+              "AutoPas::generateTuningStrategy: costModelSearch can not handle infinite verletSkins!");
+          return nullptr;
+        }
+
+        return std::make_unique<CostModelSearch>(_allowedContainers, _allowedCellSizeFactors->getAll(),
+                                                 _allowedTraversals, _allowedDataLayouts, _allowedNewton3Options,
+                                                 _allowedVerletSkins->getAll(), _allowedVerletRebuildFrequencies,
+                                                 _allowedNumThreads, _allowedScheduleOptions,
+                                                 _allowedScheduleChunkSizes, _allowedVerletClusterSizes, _maxEvidence);
       }
     }
 
@@ -592,17 +1133,17 @@ class AutoPas {
    */
   double _cutoff;
   /**
-   * Length added to the cutoff for the verlet lists' skin.
+   * Lengths added to the cutoff for the verlet lists' skin that AutoPas can choose from.
    */
-  double _verletSkin;
+  std::unique_ptr<NumberSet<double>> _allowedVerletSkins;
   /**
-   * Specifies after how many pair-wise traversals the neighbor lists are to be rebuild.
+   * Numbers of pair-wise traversals after which the neighbor lists are rebuild that AutoPas can choose from.
    */
-  unsigned int _verletRebuildFrequency;
+  std::set<unsigned int> _allowedVerletRebuildFrequencies;
   /**
-   * Specifies the size of clusters for verlet lists.
+   * Sizes of clusters for verlet cluster lists and verlet cluster cells that AutoPas can choose from.
    */
-  unsigned int _verletClusterSize;
+  std::set<unsigned int> _allowedVerletClusterSizes;
   /**
    * Number of timesteps after which the auto-tuner shall reevaluate all selections.
    */
@@ -611,15 +1152,92 @@ class AutoPas {
    * Number of samples the tuner should collect for each combination.
    */
   unsigned int _numSamples;
+  /**
+   * Maximal number of samples the tuner may collect for each combination with adaptive sampling.
+   */
+  unsigned int _maxNumSamples;
+  /**
+   * Relative half width of the confidence interval below which the tuner stops sampling a combination.
+   */
+  double _relativeConfidenceWidth;
+  /**
+   * Factor by which the first sample of a configuration may exceed the fastest evidence before it is discarded.
+   */
+  double _earlyStoppingFactor;
+  /**
+   * Number of standard deviations the iteration time may drift before a tuning phase is started early.
+   */
+  double _driftThreshold;
+  /**
+   * Number of iterations used for the reference and the current time of the drift detection.
+   */
+  unsigned int _driftWindowSize;
+  /**
+   * Rules to exclude configurations from tuning phases.
+   */
+  std::vector<PruningRule> _pruningRules;
+  /**
+   * File where tuning results are persisted. Empty string disables the tuning database.
+   */
+  std::string _tuningDatabaseFile;
+  /**
+   * File where all measurements of tuning phases are recorded. Empty string disables recording.
+   */
+  std::string _tuningRecordFile;
+  /**
+   * Whether functor types other than the first relevant one select their own traversal, data layout and newton 3
+   * option.
+   */
+  bool _tuneFunctorsIndependently{false};
+  /**
+   * Fraction of the domain volume on which configurations are measured first. One disables proxy tuning.
+   */
+  double _proxyDomainFraction{1.};
+  /**
+   * Number of configurations of the proxy domain that are sampled on the full domain.
+   */
+  unsigned int _numProxyConfirmations{3};
+  /**
+   * Whether hardware performance counters are read during tuning.
+   */
+  bool _usePerformanceCounters{false};
+  /**
+   * File where the telemetry of every iteration is written. Empty string disables telemetry.
+   */
+  std::string _telemetryFile;
+  /**
+   * Format of the telemetry file.
+   */
+  TelemetryFormatOption _telemetryFormat{TelemetryFormatOption::csv};
+  /**
+   * Whether the neighbor lists are rebuilt as soon as twice the maximal displacement exceeds the skin.
+   */
+  bool _rebuildOnDisplacement{false};
+  /**
+   * Fraction of the skin below which VerletLists keep the lists of calm cells on a rebuild.
+   */
+  double _incrementalRebuildThreshold{0.};
+  /**
+   * Whether VerletLists store their neighbor lists with 32 bit indices.
+   */
+  bool _useCompactNeighborLists{false};
   /**
    * Tuning Strategies which work on a fixed number of evidence should use this value.
    */
   unsigned int _maxEvidence;
+  /**
+   * Only the fastest 1/reductionFactor configurations survive a round of successive halving.
+   */
+  double _successiveHalvingReductionFactor;
   /**
    * Acquisition function used for tuning.
    * For possible acquisition function choices see AutoPas::AcquisitionFunction.
    */
   AcquisitionFunctionOption _acquisitionFunctionOption;
+  /**
+   * Whether the bayesian search uses a CostModel as prior mean.
+   */
+  bool _useCostModelPrior{false};
 
   /**
    * Strategy option for the auto tuner.
@@ -655,6 +1273,18 @@ class AutoPas {
    * Cell size factor to be used in this container (only relevant for LinkedCells, VerletLists and VerletListsCells).
    */
   std::unique_ptr<NumberSet<double>> _allowedCellSizeFactors;
+  /**
+   * Numbers of OpenMP threads the traversals may use that AutoPas can choose from. 0 means all available threads.
+   */
+  std::set<unsigned int> _allowedNumThreads;
+  /**
+   * OpenMP schedule kinds for the traversals that AutoPas can choose from.
+   */
+  std::set<ScheduleOption> _allowedScheduleOptions;
+  /**
+   * OpenMP schedule chunk sizes for the traversals that AutoPas can choose from.
+   */
+  std::set<unsigned int> _allowedScheduleChunkSizes;
 
   /**
    * LogicHandler of autopas.
@@ -6,17 +6,23 @@
 
 #pragma once
 #include <limits>
+#include <memory>
+#include <string>
 
 #include "autopas/iterators/ParticleIteratorWrapper.h"
+#include "autopas/options/TelemetryFormatOption.h"
 #include "autopas/selectors/AutoTuner.h"
+#include "autopas/selectors/TelemetryWriter.h"
+#include "autopas/utils/ArrayMath.h"
 #include "autopas/utils/Logger.h"
+#include "autopas/utils/Timer.h"
 
 namespace autopas {
 
 /**
  * The LogicHandler takes care of the containers s.t. they are all in the same valid state.
- * This is mainly done by incorporating a global container rebuild frequency, which defines when containers and their
- * neighbor lists will be rebuild.
+ * This is mainly done by incorporating the container rebuild frequency of the current configuration, which defines when
+ * containers and their neighbor lists will be rebuild.
  */
 template <typename Particle, typename ParticleCell>
 class LogicHandler {
@@ -24,10 +30,18 @@ class LogicHandler {
   /**
    * Constructor of the LogicHandler.
    * @param autoTuner
-   * @param rebuildFrequency
+   * @param telemetryFile File where one record per iteratePairwise() call is written. Empty string disables telemetry.
+   * @param telemetryFormat
+   * @param rebuildOnDisplacement If true, the container is also invalidated as soon as twice the maximal displacement
+   * of a particle since the last rebuild exceeds the skin.
    */
-  LogicHandler(autopas::AutoTuner<Particle, ParticleCell> &autoTuner, unsigned int rebuildFrequency)
-      : _containerRebuildFrequency{rebuildFrequency}, _autoTuner(autoTuner) {
+  explicit LogicHandler(autopas::AutoTuner<Particle, ParticleCell> &autoTuner, const std::string &telemetryFile = "",
+                        TelemetryFormatOption telemetryFormat = TelemetryFormatOption::csv,
+                        bool rebuildOnDisplacement = false)
+      : _autoTuner(autoTuner),
+        _rebuildOnDisplacement(rebuildOnDisplacement),
+        _telemetryWriter(telemetryFile.empty() ? nullptr
+                                               : std::make_unique<TelemetryWriter>(telemetryFile, telemetryFormat)) {
     checkMinimalSize();
   }
 
@@ -40,7 +54,10 @@ class LogicHandler {
     if (not isContainerValid() or forced) {
       AutoPasLog(debug, "Initiating container update.");
       _containerIsValid = false;
+      utils::Timer timerUpdate;
+      timerUpdate.start();
       auto returnPair = std::make_pair(std::move(_autoTuner.getContainer()->updateContainer()), true);
+      _containerUpdateTime += timerUpdate.stop();
       // update container returns the particles which were previously owned and are now removed.
       // Therefore remove them from the counter.
       _numParticlesOwned.fetch_sub(returnPair.first.size(), std::memory_order_relaxed);
@@ -150,8 +167,23 @@ class LogicHandler {
       // list is now valid
       _containerIsValid = true;
       _stepsSinceLastContainerRebuild = 0;
+      if (_rebuildOnDisplacement) {
+        storePositionsAtRebuild();
+      }
     }
     ++_stepsSinceLastContainerRebuild;
+    _displacementIsChecked = false;
+
+    if (_telemetryWriter) {
+      auto telemetry = _autoTuner.getLastIterationTelemetry();
+      telemetry.iteration = _numIteratePairwiseCalls;
+      telemetry.containerUpdateTime = _containerUpdateTime;
+      telemetry.numParticlesOwned = _numParticlesOwned;
+      telemetry.numParticlesHalo = _numParticlesHalo;
+      _telemetryWriter->record(telemetry);
+    }
+    _containerUpdateTime = 0;
+    ++_numIteratePairwiseCalls;
 
     return result;
   }
@@ -221,17 +253,59 @@ class LogicHandler {
   }
 
   bool isContainerValid() {
-    if (_stepsSinceLastContainerRebuild >= _containerRebuildFrequency or _autoTuner.willRebuild()) {
+    // the rebuild frequency is part of the tuned configuration
+    if (_stepsSinceLastContainerRebuild >= _autoTuner.getCurrentConfig().verletRebuildFrequency or
+        _autoTuner.willRebuild()) {
       _containerIsValid = false;
     }
+    // with the displacement criterion the rebuild frequency is only an upper bound.
+    // The displacement is only checked by the first call per step, which usually is updateContainer(), so adding halo
+    // particles does not trigger a pass over all particles each.
+    if (_containerIsValid and _rebuildOnDisplacement and not _displacementIsChecked) {
+      _displacementIsChecked = true;
+      if (displacementExceedsSkin()) {
+        _containerIsValid = false;
+      }
+    }
     return _containerIsValid;
   }
 
   /**
-   * Specifies after how many pair-wise traversals the container and their neighbor lists (if they exist) are to be
-   * rebuild.
+   * Stores the positions of all particles in iteration order.
+   * Until the next rebuild no particle is added, removed or moved to another cell, so the iteration order stays the
+   * same.
    */
-  const unsigned int _containerRebuildFrequency;
+  void storePositionsAtRebuild() {
+    _positionsAtRebuild.clear();
+    for (auto iter = _autoTuner.getContainer()->begin(); iter.isValid(); ++iter) {
+      _positionsAtRebuild.push_back(iter->getR());
+    }
+  }
+
+  /**
+   * Checks whether a pair of particles might have come closer than the cutoff without being in the neighbor lists.
+   * This can only happen if the two particles together moved more than the skin, i.e. if twice the maximal
+   * displacement since the last rebuild exceeds the skin.
+   * @return
+   */
+  bool displacementExceedsSkin() {
+    const double skin = _autoTuner.getContainer()->getSkin();
+    // 2 * displacement > skin <=> 4 * displacement^2 > skin^2
+    const double maxDisplacementSquared = skin * skin / 4.;
+    size_t i = 0;
+    for (auto iter = _autoTuner.getContainer()->begin(); iter.isValid(); ++iter, ++i) {
+      if (i >= _positionsAtRebuild.size()) {
+        // particles were added, which should have invalidated the container anyway
+        return true;
+      }
+      const auto displacement = utils::ArrayMath::sub(iter->getR(), _positionsAtRebuild[i]);
+      if (utils::ArrayMath::dot(displacement, displacement) > maxDisplacementSquared) {
+        AutoPasLog(debug, "Particle moved more than skin/2 since the last rebuild. Invalidating the container.");
+        return true;
+      }
+    }
+    return i != _positionsAtRebuild.size();
+  }
 
   /**
    * Reference to the AutoTuner that owns the container, ...
@@ -243,6 +317,21 @@ class LogicHandler {
    */
   bool _containerIsValid{false};
 
+  /**
+   * Whether the container is invalidated when twice the maximal displacement since the last rebuild exceeds the skin.
+   */
+  bool _rebuildOnDisplacement;
+
+  /**
+   * Positions of all particles at the last rebuild in iteration order. Only filled if _rebuildOnDisplacement is true.
+   */
+  std::vector<std::array<double, 3>> _positionsAtRebuild;
+
+  /**
+   * Whether the displacement was already checked since the last call to iteratePairwise().
+   */
+  bool _displacementIsChecked{false};
+
   /**
    * Steps since last rebuild
    */
@@ -257,5 +346,20 @@ class LogicHandler {
    * Atomic tracker of the number of halo particles.
    */
   std::atomic<size_t> _numParticlesHalo{0ul};
+
+  /**
+   * Writes the telemetry of every iteratePairwise() call. nullptr if telemetry is disabled.
+   */
+  std::unique_ptr<TelemetryWriter> _telemetryWriter;
+
+  /**
+   * Time of the container updates since the last iteratePairwise() call in nanoseconds.
+   */
+  long _containerUpdateTime{0};
+
+  /**
+   * Number of iteratePairwise() calls so far.
+   */
+  size_t _numIteratePairwiseCalls{0};
 };
 }  // namespace autopas
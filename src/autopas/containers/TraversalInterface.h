@@ -8,6 +8,7 @@
 
 #include "autopas/options/DataLayoutOption.h"
 #include "autopas/options/TraversalOption.h"
+#include "autopas/utils/Timer.h"
 #if defined(AUTOPAS_CUDA)
 #include "cuda_runtime.h"
 #endif
@@ -62,6 +63,46 @@ class TraversalInterface {
    * Traverses all particle pairs.
    */
   virtual void traverseParticlePairs() = 0;
+
+  /**
+   * Runs initTraversal(), traverseParticlePairs() and endTraversal() and measures each of them.
+   * Containers use this in iteratePairwise() so loading and extracting the SoA buffers can be reported separately.
+   */
+  void runTraversal() {
+    utils::Timer timer;
+    timer.start();
+    initTraversal();
+    _initTraversalTime = timer.stop();
+    timer.start();
+    traverseParticlePairs();
+    _traverseParticlePairsTime = timer.stop();
+    timer.start();
+    endTraversal();
+    _endTraversalTime = timer.stop();
+  }
+
+  /**
+   * Time of initTraversal() during the last runTraversal() in nanoseconds.
+   * @return
+   */
+  long getInitTraversalTime() const { return _initTraversalTime; }
+
+  /**
+   * Time of traverseParticlePairs() during the last runTraversal() in nanoseconds.
+   * @return
+   */
+  long getTraverseParticlePairsTime() const { return _traverseParticlePairsTime; }
+
+  /**
+   * Time of endTraversal() during the last runTraversal() in nanoseconds.
+   * @return
+   */
+  long getEndTraversalTime() const { return _endTraversalTime; }
+
+ private:
+  long _initTraversalTime{0};
+  long _traverseParticlePairsTime{0};
+  long _endTraversalTime{0};
 };
 
 }  // namespace autopas
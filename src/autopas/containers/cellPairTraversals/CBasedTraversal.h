@@ -10,6 +10,7 @@
 #include "autopas/utils/ArrayMath.h"
 #include "autopas/utils/DataLayoutConverter.h"
 #include "autopas/utils/ThreeDimensionalMapping.h"
+#include "autopas/utils/TraceRecorder.h"
 
 namespace autopas {
 
@@ -147,31 +148,42 @@ inline void CBasedTraversal<ParticleCell, PairwiseFunctor, dataLayout, useNewton
       const unsigned long start_x = start[0], start_y = start[1], start_z = start[2];
       const unsigned long end_x = end[0], end_y = end[1], end_z = end[2];
       const unsigned long stride_x = stride[0], stride_y = stride[1], stride_z = stride[2];
-      if (collapseDepth == 2) {
+      {
+        utils::TraceScope traceColor("color", col);
+        if (collapseDepth == 2) {
 #if defined(AUTOPAS_OPENMP)
-#pragma omp for schedule(dynamic, 1) collapse(2)
+// the schedule is set by the AutoTuner according to the current configuration
+#pragma omp for schedule(runtime) collapse(2) nowait
 #endif
-        for (unsigned long z = start_z; z < end_z; z += stride_z) {
-          for (unsigned long y = start_y; y < end_y; y += stride_y) {
-            for (unsigned long x = start_x; x < end_x; x += stride_x) {
-              // Don't exchange order of execution (x must be last!), it would break other code
-              loopBody(x, y, z);
+          for (unsigned long z = start_z; z < end_z; z += stride_z) {
+            for (unsigned long y = start_y; y < end_y; y += stride_y) {
+              for (unsigned long x = start_x; x < end_x; x += stride_x) {
+                // Don't exchange order of execution (x must be last!), it would break other code
+                loopBody(x, y, z);
+              }
             }
           }
-        }
-      } else {
+        } else {
 #if defined(AUTOPAS_OPENMP)
-#pragma omp for schedule(dynamic, 1) collapse(3)
+#pragma omp for schedule(runtime) collapse(3) nowait
 #endif
-        for (unsigned long z = start_z; z < end_z; z += stride_z) {
-          for (unsigned long y = start_y; y < end_y; y += stride_y) {
-            for (unsigned long x = start_x; x < end_x; x += stride_x) {
-              // Don't exchange order of execution (x must be last!), it would break other code
-              loopBody(x, y, z);
+          for (unsigned long z = start_z; z < end_z; z += stride_z) {
+            for (unsigned long y = start_y; y < end_y; y += stride_y) {
+              for (unsigned long x = start_x; x < end_x; x += stride_x) {
+                // Don't exchange order of execution (x must be last!), it would break other code
+                loopBody(x, y, z);
+              }
             }
           }
         }
       }
+#if defined(AUTOPAS_OPENMP)
+      // explicit instead of the implicit barrier of the loop, so the time threads wait for each other is traced
+      {
+        utils::TraceScope traceBarrier("barrier", col);
+#pragma omp barrier
+      }
+#endif
     }
   }
 }
@@ -12,6 +12,7 @@
 #include "autopas/containers/cellPairTraversals/CellPairTraversal.h"
 #include "autopas/utils/DataLayoutConverter.h"
 #include "autopas/utils/ThreeDimensionalMapping.h"
+#include "autopas/utils/TraceRecorder.h"
 #include "autopas/utils/WrapOpenMP.h"
 
 namespace autopas {
@@ -212,6 +213,7 @@ void SlicedBasedTraversal<ParticleCell, PairwiseFunctor, dataLayout, useNewton3>
 #pragma omp parallel for schedule(static, 1) num_threads(numSlices)
 #endif
   for (size_t slice = 0; slice < numSlices; ++slice) {
+    utils::TraceScope traceSlice("slice", slice);
     array<unsigned long, 3> myStartArray{0, 0, 0};
     for (size_t i = 0; i < slice; ++i) {
       myStartArray[_dimsPerLength[0]] += _sliceThickness[i];
@@ -219,6 +221,7 @@ void SlicedBasedTraversal<ParticleCell, PairwiseFunctor, dataLayout, useNewton3>
 
     // all but the first slice need to lock their starting layers.
     if (slice > 0) {
+      utils::TraceScope traceLock("lock wait", slice);
       for (unsigned long i = 0ul; i < _overlapLongestAxis; i++) {
         locks[((slice - 1) * _overlapLongestAxis) + i].lock();
       }
@@ -228,6 +231,7 @@ void SlicedBasedTraversal<ParticleCell, PairwiseFunctor, dataLayout, useNewton3>
       // at the last layers request lock for the starting layer of the next
       // slice. Does not apply for the last slice.
       if (slice != numSlices - 1 && dimSlice >= lastLayer - _overlapLongestAxis) {
+        utils::TraceScope traceLock("lock wait", slice);
         locks[((slice + 1) * _overlapLongestAxis) - (lastLayer - dimSlice)].lock();
       }
       for (unsigned long dimMedium = 0; dimMedium < this->_cellsPerDimension[_dimsPerLength[1]] - overLapps23[0];
@@ -102,9 +102,7 @@ class DirectSum : public ParticleContainer<ParticleCell> {
           "trying to use a traversal of wrong type in DirectSum::iteratePairwise");
     }
 
-    traversal->initTraversal();
-    traversal->traverseParticlePairs();
-    traversal->endTraversal();
+    traversal->runTraversal();
   }
 
   AUTOPAS_WARN_UNUSED_RESULT
@@ -119,9 +119,7 @@ class LinkedCells : public ParticleContainer<ParticleCell, SoAArraysType> {
           traversal->getTraversalType());
     }
 
-    traversal->initTraversal();
-    traversal->traverseParticlePairs();
-    traversal->endTraversal();
+    traversal->runTraversal();
   }
 
   AUTOPAS_WARN_UNUSED_RESULT
@@ -197,7 +197,7 @@ void C04Traversal<ParticleCell, PairwiseFunctor, dataLayout, useNewton3>::traver
 
 // first cartesian grid
 #if defined(AUTOPAS_OPENMP)
-#pragma omp for schedule(dynamic, 1) collapse(3) nowait
+#pragma omp for schedule(runtime) collapse(3) nowait
 #endif
   for (long z = startZ; z < endZ; z += 4) {
     for (long y = startY; y < endY; y += 4) {
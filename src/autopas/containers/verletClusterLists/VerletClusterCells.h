@@ -86,9 +86,7 @@ class VerletClusterCells : public ParticleContainer<FullParticleCell<Particle>>
     }
 
     cellPairTraversal->setCellsToTraverse(this->_cells);
-    traversal->initTraversal();
-    traversal->traverseParticlePairs();
-    traversal->endTraversal();
+    traversal->runTraversal();
   }
 
   /**
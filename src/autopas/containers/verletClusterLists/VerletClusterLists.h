@@ -74,9 +74,7 @@ class VerletClusterLists : public ParticleContainer<FullParticleCell<Particle>>
           traversal->getTraversalType());
     }
 
-    traversal->initTraversal();
-    traversal->traverseParticlePairs();
-    traversal->endTraversal();
+    traversal->runTraversal();
   }
 
   /**
@@ -271,8 +269,8 @@ class VerletClusterLists : public ParticleContainer<FullParticleCell<Particle>>
     const index_t endX = _cellsPerDim[0];
     const index_t endY = _cellsPerDim[1];
 #if defined(AUTOPAS_OPENMP)
-    // @todo: find sensible chunksize
-#pragma omp parallel for schedule(dynamic) collapse(2)
+    // the schedule is set by the AutoTuner according to the current configuration
+#pragma omp parallel for schedule(runtime) collapse(2)
 #endif
     for (index_t x = 0; x < endX; x++) {
       for (index_t y = 0; y < endY; y++) {
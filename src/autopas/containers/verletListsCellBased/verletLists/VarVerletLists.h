@@ -53,9 +53,7 @@ class VarVerletLists
           "trying to use a traversal of wrong type in VarVerletLists::iteratePairwise");
     }
 
-    traversal->initTraversal();
-    traversal->traverseParticlePairs();
-    traversal->endTraversal();
+    traversal->runTraversal();
   }
 
   /**
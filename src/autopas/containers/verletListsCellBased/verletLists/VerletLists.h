@@ -6,6 +6,10 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
 #include "VerletListHelpers.h"
 #include "autopas/containers/ParticleContainer.h"
 #include "autopas/containers/linkedCells/LinkedCells.h"
@@ -15,7 +19,8 @@
 #include "autopas/containers/verletListsCellBased/verletLists/traversals/VerletTraversalInterface.h"
 #include "autopas/options/DataLayoutOption.h"
 #include "autopas/utils/ArrayMath.h"
-#include "autopas/utils/StaticSelectorMacros.h"
+#include "autopas/utils/CSRNeighborLists.h"
+#include "autopas/utils/ThreeDimensionalMapping.h"
 
 namespace autopas {
 
@@ -45,8 +50,8 @@ class VerletLists
    * Enum that specifies how the verlet lists should be build
    */
   enum BuildVerletListType {
-    VerletAoS,  /// build it using AoS
-    VerletSoA   /// build it using SoA
+    VerletAoS,  /// build it reading the positions from the particles
+    VerletSoA   /// build it on a contiguous copy of the positions
   };
 
   /**
@@ -58,14 +63,27 @@ class VerletLists
    * @param skin The skin radius.
    * @param buildVerletListType Specifies how the verlet list should be build, see BuildVerletListType
    * @param cellSizeFactor cell size factor ralative to cutoff
+   * @param incrementalRebuildThreshold Fraction of the skin. If positive, a rebuild only regenerates the lists of
+   * particles in cells where a particle moved further than this since its reference position or the particles changed,
+   * as well as in the adjacent cells. Has to be smaller than 0.25, see rebuildNeighborLists().
+   * @param useCompactNeighborLists If true, the neighbor lists store 32 bit indices, which halves their size. Requires
+   * functors that implement the SoAFunctor for CSRNeighborLists<uint32_t>.
    */
   VerletLists(const std::array<double, 3> boxMin, const std::array<double, 3> boxMax, const double cutoff,
               const double skin, const BuildVerletListType buildVerletListType = BuildVerletListType::VerletSoA,
-              const double cellSizeFactor = 1.0)
+              const double cellSizeFactor = 1.0, const double incrementalRebuildThreshold = 0.,
+              const bool useCompactNeighborLists = false)
       : VerletListsLinkedBase<Particle, LinkedParticleCell, SoAArraysType>(
             boxMin, boxMax, cutoff, skin, compatibleTraversals::allVLCompatibleTraversals(), cellSizeFactor),
-        _soaListIsValid(false),
-        _buildVerletListType(buildVerletListType) {}
+        _aosListIsValid(false),
+        _buildVerletListType(buildVerletListType),
+        _incrementalRebuildThreshold(incrementalRebuildThreshold * skin),
+        _useCompactNeighborLists(useCompactNeighborLists) {
+    if (incrementalRebuildThreshold < 0. or incrementalRebuildThreshold >= .25) {
+      utils::ExceptionHandler::exception("VerletLists: incrementalRebuildThreshold has to be in [0, 0.25) but is {}",
+                                         incrementalRebuildThreshold);
+    }
+  }
 
   ContainerOption getContainerType() const override { return ContainerOption::verletLists; }
 
@@ -75,23 +93,45 @@ class VerletLists
     // Check if traversal is allowed for this container and give it the data it needs.
     auto *verletTraversalInterface = dynamic_cast<VerletTraversalInterface<LinkedParticleCell> *>(traversal);
     if (verletTraversalInterface) {
-      verletTraversalInterface->setCellsAndNeighborLists(this->_linkedCells.getCells(), _aosNeighborLists,
-                                                         _soaNeighborLists);
+      if (_useCompactNeighborLists) {
+        verletTraversalInterface->setCellsAndNeighborLists(this->_linkedCells.getCells(), _particles,
+                                                           _compactNeighborLists);
+      } else {
+        verletTraversalInterface->setCellsAndNeighborLists(this->_linkedCells.getCells(), _particles, _neighborLists);
+      }
     } else {
       autopas::utils::ExceptionHandler::exception(
           "trying to use a traversal of wrong type in VerletLists::iteratePairwise");
     }
 
-    traversal->initTraversal();
-    traversal->traverseParticlePairs();
-    traversal->endTraversal();
+    traversal->runTraversal();
   }
 
   /**
    * get the actual neighbour list
    * @return the neighbour list
+   * @note The map is generated from the neighbor lists on first access after a rebuild.
+   */
+  typename verlet_internal::AoS_verletlist_storage_type &getVerletListsAoS() {
+    if (not _aosListIsValid) {
+      generateAoSNeighborLists();
+    }
+    return _aosNeighborLists;
+  }
+
+  /**
+   * Get the neighbor lists.
+   * @return Neighbor lists in compressed sparse row format. Particles are indexed in the order of the cells. Empty if
+   * compact neighbor lists are used.
+   */
+  const CSRNeighborLists<size_t> &getVerletListsSoA() const { return _neighborLists; }
+
+  /**
+   * Get the compact neighbor lists.
+   * @return Neighbor lists in compressed sparse row format with 32 bit indices. Empty unless compact neighbor lists are
+   * used.
    */
-  typename verlet_internal::AoS_verletlist_storage_type &getVerletListsAoS() { return _aosNeighborLists; }
+  const CSRNeighborLists<uint32_t> &getCompactVerletListsSoA() const { return _compactNeighborLists; }
 
   /**
    * Checks whether the neighbor lists are valid.
@@ -115,7 +155,7 @@ class VerletLists
 
     // particles can also simply be very close already:
     typename verlet_internal::template VerletListValidityCheckerFunctor<LinkedParticleCell> validityCheckerFunctor(
-        _aosNeighborLists, (this->getCutoff()));
+        getVerletListsAoS(), (this->getCutoff()));
 
     auto traversal =
         C08Traversal<LinkedParticleCell,
@@ -130,129 +170,342 @@ class VerletLists
 
   /**
    * Rebuilds the verlet lists, marks them valid and resets the internal counter.
+   * The same lists are used for AoS and SoA traversals.
+   *
+   * With an incremental rebuild threshold every particle has a reference position. A cell is calm if it contains the
+   * same particles in the same order as at the previous rebuild and none of them moved further than the threshold from
+   * its reference position. The lists of particles whose cell and adjacent cells are all calm are kept, all others are
+   * regenerated. The reference positions of the particles in cells that are not calm are reset to their current
+   * positions. Hence, two particles of a kept list moved at most 4 * threshold relative to each other since the list
+   * was generated, so the lists stay valid as long as no particle moves further than skin / 2 - 2 * threshold after
+   * the rebuild.
    * @note This function will be called in iteratePairwiseAoS() and iteratePairwiseSoA() appropriately!
    * @param traversal
    */
   void rebuildNeighborLists(TraversalInterface *traversal) override {
     this->_verletBuiltNewton3 = traversal->getUseNewton3();
-    this->updateVerletListsAoS(traversal->getUseNewton3());
+    buildNeighborLists(traversal->getUseNewton3());
     // the neighbor list is now valid
     this->_neighborListIsValid = true;
-
-    if (not _soaListIsValid and traversal->getDataLayout() == DataLayoutOption::soa) {
-      // only do this if we need it, i.e., if we are using soa!
-      generateSoAListFromAoSVerletLists();
-    }
   }
 
  protected:
   /**
-   * Update the verlet lists for AoS usage
-   * @param useNewton3
+   * Builds the neighbor lists of all particles directly from the cells.
+   *
+   * The index of a particle is its position when iterating all cells in order, which is the order the traversal loads
+   * the particles into the SoA. Every particle is compared to the particles of its own and the adjacent cells, which
+   * suffices because the cells are at least as large as the interaction length.
+   *
+   * All steps run in parallel without shared mutable state: first the neighbors of every particle are counted, then
+   * the offsets of the lists are computed by a prefix sum and finally every list is filled at its offset.
+   * @param useNewton3 If true, every pair is only stored in the list of the particle with the smaller index.
    */
-  virtual void updateVerletListsAoS(bool useNewton3) {
-    updateIdMapAoS();
-    typename verlet_internal::VerletListGeneratorFunctor f(_aosNeighborLists, this->getCutoff() + this->getSkin());
+  void buildNeighborLists(bool useNewton3) {
+    auto &cells = this->_linkedCells.getCells();
+
+    // index of the first particle of every cell
+    std::vector<size_t> cellOffsets(cells.size() + 1, 0);
+    for (size_t cellIndex = 0; cellIndex < cells.size(); ++cellIndex) {
+      cellOffsets[cellIndex + 1] = cellOffsets[cellIndex] + cells[cellIndex].numParticles();
+    }
+    const size_t numParticles = cellOffsets.back();
+
+    _particles.resize(numParticles);
+#ifdef AUTOPAS_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (size_t cellIndex = 0; cellIndex < cells.size(); ++cellIndex) {
+      for (size_t i = 0; i < cells[cellIndex].numParticles(); ++i) {
+        _particles[cellOffsets[cellIndex] + i] = &cells[cellIndex][i];
+      }
+    }
+
+    const auto cellIsCalm = findCalmCells(useNewton3, cellOffsets);
+
+    auto build = [&](auto getPosition) {
+      if (_useCompactNeighborLists) {
+        if (numParticles > std::numeric_limits<uint32_t>::max()) {
+          utils::ExceptionHandler::exception(
+              "VerletLists::buildNeighborLists(): {} particles can not be indexed by compact neighbor lists.",
+              numParticles);
+        }
+        buildNeighborListsImpl(_compactNeighborLists, useNewton3, cellOffsets, cellIsCalm, getPosition);
+      } else {
+        buildNeighborListsImpl(_neighborLists, useNewton3, cellOffsets, cellIsCalm, getPosition);
+      }
+    };
 
-    /// @todo autotune traversal
     switch (_buildVerletListType) {
       case BuildVerletListType::VerletAoS: {
-        utils::withStaticBool(useNewton3, [&](auto theBool) {
-          auto traversal = C08Traversal<LinkedParticleCell, typename verlet_internal::VerletListGeneratorFunctor,
-                                        DataLayoutOption::aos, theBool>(
-              this->_linkedCells.getCellBlock().getCellsPerDimensionWithHalo(), &f, this->getInteractionLength(),
-              this->_linkedCells.getCellBlock().getCellLength());
-          this->_linkedCells.iteratePairwise(&traversal);
-        });
+        build([&](size_t i) -> const std::array<double, 3> & { return _particles[i]->getR(); });
         break;
       }
       case BuildVerletListType::VerletSoA: {
-        utils::withStaticBool(useNewton3, [&](auto theBool) {
-          auto traversal = C08Traversal<LinkedParticleCell, typename verlet_internal::VerletListGeneratorFunctor,
-                                        DataLayoutOption::soa, theBool>(
-              this->_linkedCells.getCellBlock().getCellsPerDimensionWithHalo(), &f, this->getInteractionLength(),
-              this->_linkedCells.getCellBlock().getCellLength());
-          this->_linkedCells.iteratePairwise(&traversal);
-        });
+        // contiguous copy of the positions, so the distance checks do not have to chase particles
+        std::vector<std::array<double, 3>> positions(numParticles);
+#ifdef AUTOPAS_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (size_t i = 0; i < numParticles; ++i) {
+          positions[i] = _particles[i]->getR();
+        }
+        build([&](size_t i) -> const std::array<double, 3> & { return positions[i]; });
         break;
       }
       default:
-        utils::ExceptionHandler::exception("VerletLists::updateVerletListsAoS(): unsupported BuildVerletListType: {}",
+        utils::ExceptionHandler::exception("VerletLists::buildNeighborLists(): unsupported BuildVerletListType: {}",
                                            _buildVerletListType);
         break;
     }
 
-    _soaListIsValid = false;
+    AutoPasLog(debug, "VerletLists::buildNeighborLists: average verlet list size is {}",
+               static_cast<double>(_neighborLists.getNumNeighbors() + _compactNeighborLists.getNumNeighbors()) /
+                   numParticles);
+    _aosListIsValid = false;
+
+    if (_incrementalRebuildThreshold > 0.) {
+      updateReferences(useNewton3, cellOffsets, cellIsCalm);
+    }
   }
 
   /**
-   * update the AoS id maps.
-   * The Id Map is used to map the id of a particle to the actual particle
-   * @return
+   * Determines which cells still contain the same particles as at the previous rebuild, none of which moved further
+   * than the incremental rebuild threshold from its reference position.
+   * @param useNewton3
+   * @param cellOffsets Index of the first particle of every cell followed by the number of particles.
+   * @return One entry per cell. All false if incremental rebuilds are disabled or impossible.
    */
-  size_t updateIdMapAoS() {
-    size_t i = 0;
-    _aosNeighborLists.clear();
-    // DON'T simply parallelize this loop!!! this needs modifications if you
-    // want to parallelize it!
-    for (auto iter = this->begin(); iter.isValid(); ++iter, ++i) {
-      // create the verlet list entries for all particles
-      _aosNeighborLists[&(*iter)];
+  std::vector<char> findCalmCells(bool useNewton3, const std::vector<size_t> &cellOffsets) const {
+    const size_t numCells = cellOffsets.size() - 1;
+    // char instead of bool so that the cells can be written in parallel
+    std::vector<char> cellIsCalm(numCells, false);
+    if (_incrementalRebuildThreshold <= 0. or _referenceCellOffsets.size() != cellOffsets.size() or
+        _referenceNewton3 != useNewton3) {
+      return cellIsCalm;
+    }
+    const double thresholdSquared = _incrementalRebuildThreshold * _incrementalRebuildThreshold;
+#ifdef AUTOPAS_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (size_t cellIndex = 0; cellIndex < numCells; ++cellIndex) {
+      const size_t numParticlesInCell = cellOffsets[cellIndex + 1] - cellOffsets[cellIndex];
+      if (numParticlesInCell != _referenceCellOffsets[cellIndex + 1] - _referenceCellOffsets[cellIndex]) {
+        continue;
+      }
+      bool calm = true;
+      for (size_t k = 0; k < numParticlesInCell and calm; ++k) {
+        const auto &particle = *_particles[cellOffsets[cellIndex] + k];
+        const size_t referenceIndex = _referenceCellOffsets[cellIndex] + k;
+        const auto displacement = utils::ArrayMath::sub(particle.getR(), _referencePositions[referenceIndex]);
+        calm = particle.getID() == _referenceIds[referenceIndex] and
+               utils::ArrayMath::dot(displacement, displacement) <= thresholdSquared;
+      }
+      cellIsCalm[cellIndex] = calm;
     }
+    return cellIsCalm;
+  }
 
-    return i;
+  /**
+   * Stores the state the next incremental rebuild compares against.
+   * Particles in calm cells keep their reference positions, all others get their current position.
+   * @param useNewton3
+   * @param cellOffsets Index of the first particle of every cell followed by the number of particles.
+   * @param cellIsCalm
+   */
+  void updateReferences(bool useNewton3, const std::vector<size_t> &cellOffsets, const std::vector<char> &cellIsCalm) {
+    const size_t numCells = cellOffsets.size() - 1;
+    std::vector<std::array<double, 3>> referencePositions(cellOffsets.back());
+    _referenceIds.resize(cellOffsets.back());
+#ifdef AUTOPAS_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (size_t cellIndex = 0; cellIndex < numCells; ++cellIndex) {
+      for (size_t i = cellOffsets[cellIndex]; i < cellOffsets[cellIndex + 1]; ++i) {
+        // in a calm cell the particles are at the same position within the cell as before
+        referencePositions[i] = cellIsCalm[cellIndex]
+                                    ? _referencePositions[i - cellOffsets[cellIndex] + _referenceCellOffsets[cellIndex]]
+                                    : _particles[i]->getR();
+        _referenceIds[i] = _particles[i]->getID();
+      }
+    }
+    _referencePositions = std::move(referencePositions);
+    _referenceCellOffsets = cellOffsets;
+    _referenceNewton3 = useNewton3;
   }
 
   /**
-   * Converts the verlet list stored for AoS usage into one for SoA usage
+   * Counts and fills the neighbor lists.
+   * @tparam IndexType Type of the neighbor indices.
+   * @tparam PositionGetter Callable returning the position of the particle with the given index.
+   * @param neighborLists Lists to fill. If lists are kept they have to hold the lists of the previous rebuild.
+   * @param useNewton3
+   * @param cellOffsets Index of the first particle of every cell followed by the number of particles.
+   * @param cellIsCalm Particles whose cell and adjacent cells are all calm keep their previous lists.
+   * @param getPosition
    */
-  void generateSoAListFromAoSVerletLists() {
-    // resize the list to the size of the aos neighborlist
-    _soaNeighborLists.resize(_aosNeighborLists.size());
-    // clear the aos 2 soa map
-    _aos2soaMap.clear();
-
-    _aos2soaMap.reserve(_aosNeighborLists.size());
-    size_t i = 0;
-    for (auto iter = this->begin(); iter.isValid(); ++iter, ++i) {
-      // set the map
-      _aos2soaMap[&(*iter)] = i;
+  template <class IndexType, class PositionGetter>
+  void buildNeighborListsImpl(CSRNeighborLists<IndexType> &neighborLists, bool useNewton3,
+                              const std::vector<size_t> &cellOffsets, const std::vector<char> &cellIsCalm,
+                              PositionGetter getPosition) {
+    const auto &cellsPerDimension = this->_linkedCells.getCellBlock().getCellsPerDimensionWithHalo();
+    const size_t numCells = cellOffsets.size() - 1;
+    const double interactionLengthSquared = this->getInteractionLength() * this->getInteractionLength();
+
+    // calls function(neighborCellIndex) for the given cell and all adjacent cells
+    auto forEachNeighborCell = [&](size_t cellIndex, auto &&function) {
+      const auto cellIndex3D = utils::ThreeDimensionalMapping::oneToThreeD(cellIndex, cellsPerDimension);
+      std::array<size_t, 3> lowerNeighbor{}, upperNeighbor{};
+      for (size_t dim = 0; dim < 3; ++dim) {
+        lowerNeighbor[dim] = cellIndex3D[dim] > 0 ? cellIndex3D[dim] - 1 : 0;
+        upperNeighbor[dim] = std::min(cellIndex3D[dim] + 1, cellsPerDimension[dim] - 1);
+      }
+      for (size_t z = lowerNeighbor[2]; z <= upperNeighbor[2]; ++z) {
+        for (size_t y = lowerNeighbor[1]; y <= upperNeighbor[1]; ++y) {
+          for (size_t x = lowerNeighbor[0]; x <= upperNeighbor[0]; ++x) {
+            function(utils::ThreeDimensionalMapping::threeToOneD(x, y, z, cellsPerDimension));
+          }
+        }
+      }
+    };
+
+    // calls function(j) for every neighbor j of particle i, which resides in the given cell
+    auto forEachNeighbor = [&](size_t cellIndex, size_t i, auto &&function) {
+      const auto &positionI = getPosition(i);
+      forEachNeighborCell(cellIndex, [&](size_t neighborCellIndex) {
+        for (size_t j = cellOffsets[neighborCellIndex]; j < cellOffsets[neighborCellIndex + 1]; ++j) {
+          if (j == i or (useNewton3 and j < i)) {
+            continue;
+          }
+          const auto dist = utils::ArrayMath::sub(positionI, getPosition(j));
+          if (utils::ArrayMath::dot(dist, dist) < interactionLengthSquared) {
+            function(j);
+          }
+        }
+      });
+    };
+
+    // the lists of a cell can be kept if it and all adjacent cells are calm
+    std::vector<char> keepLists(numCells, false);
+#ifdef AUTOPAS_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (size_t cellIndex = 0; cellIndex < numCells; ++cellIndex) {
+      bool keep = true;
+      forEachNeighborCell(cellIndex, [&](size_t neighborCellIndex) { keep = keep and cellIsCalm[neighborCellIndex]; });
+      keepLists[cellIndex] = keep;
+    }
+
+    std::vector<size_t> listSizes(cellOffsets.back());
+    size_t numKeptLists = 0;
+#ifdef AUTOPAS_OPENMP
+#pragma omp parallel for schedule(dynamic) reduction(+ : numKeptLists)
+#endif
+    for (size_t cellIndex = 0; cellIndex < numCells; ++cellIndex) {
+      for (size_t i = cellOffsets[cellIndex]; i < cellOffsets[cellIndex + 1]; ++i) {
+        if (keepLists[cellIndex]) {
+          listSizes[i] = neighborLists[i - cellOffsets[cellIndex] + _referenceCellOffsets[cellIndex]].size();
+          ++numKeptLists;
+        } else {
+          size_t listSize = 0;
+          forEachNeighbor(cellIndex, i, [&](size_t) { ++listSize; });
+          listSizes[i] = listSize;
+        }
+      }
+    }
+    if (numKeptLists > 0) {
+      AutoPasLog(debug, "VerletLists::buildNeighborLists: kept the lists of {} of {} particles", numKeptLists,
+                 listSizes.size());
+    }
+
+    // kept lists are copied from the previous lists, whose indices refer to the previous cell offsets
+    CSRNeighborLists<IndexType> previousNeighborLists;
+    if (numKeptLists > 0) {
+      std::swap(previousNeighborLists, neighborLists);
     }
-    size_t accumulatedListSize = 0;
-    for (auto &aosList : _aosNeighborLists) {
-      accumulatedListSize += aosList.second.size();
-      size_t i_id = _aos2soaMap[aosList.first];
-      // each soa neighbor list should be of the same size as for aos
-      _soaNeighborLists[i_id].resize(aosList.second.size());
-      size_t j = 0;
-      for (auto neighbor : aosList.second) {
-        _soaNeighborLists[i_id][j] = _aos2soaMap.at(neighbor);
-        j++;
+    neighborLists.setListSizes(listSizes);
+
+#ifdef AUTOPAS_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (size_t cellIndex = 0; cellIndex < numCells; ++cellIndex) {
+      for (size_t i = cellOffsets[cellIndex]; i < cellOffsets[cellIndex + 1]; ++i) {
+        auto *list = neighborLists.getList(i);
+        if (keepLists[cellIndex]) {
+          for (auto previousJ : previousNeighborLists[i - cellOffsets[cellIndex] + _referenceCellOffsets[cellIndex]]) {
+            // all neighbors are in calm cells, which contain the same particles in the same order as before
+            const auto neighborCellIndex = static_cast<size_t>(
+                std::upper_bound(_referenceCellOffsets.begin(), _referenceCellOffsets.end(), previousJ) -
+                _referenceCellOffsets.begin() - 1);
+            *(list++) = static_cast<IndexType>(previousJ - _referenceCellOffsets[neighborCellIndex] +
+                                               cellOffsets[neighborCellIndex]);
+          }
+        } else {
+          forEachNeighbor(cellIndex, i, [&](size_t j) { *(list++) = static_cast<IndexType>(j); });
+        }
+      }
+    }
+  }
+
+  /**
+   * Generates the neighbor lists stored for AoS usage from the neighbor lists.
+   */
+  void generateAoSNeighborLists() {
+    _aosNeighborLists.clear();
+    _aosNeighborLists.reserve(_particles.size());
+    auto generate = [&](const auto &neighborLists) {
+      for (size_t i = 0; i < neighborLists.size(); ++i) {
+        auto &aosList = _aosNeighborLists[_particles[i]];
+        aosList.reserve(neighborLists[i].size());
+        for (auto j : neighborLists[i]) {
+          aosList.push_back(_particles[j]);
+        }
       }
+    };
+    if (_useCompactNeighborLists) {
+      generate(_compactNeighborLists);
+    } else {
+      generate(_neighborLists);
     }
-    AutoPasLog(debug,
-               "VerletLists::generateSoAListFromAoSVerletLists: average verlet list "
-               "size is {}",
-               static_cast<double>(accumulatedListSize) / _aosNeighborLists.size());
-    _soaListIsValid = true;
+    _aosListIsValid = true;
   }
 
  private:
-  /// verlet lists.
+  /// verlet lists as map, only generated on request.
   typename verlet_internal::AoS_verletlist_storage_type _aosNeighborLists;
 
-  /// map converting from the aos type index (Particle *) to the soa type index
-  /// (continuous, size_t)
-  std::unordered_map<Particle *, size_t> _aos2soaMap;
+  /// all particles in the order of their index in the neighbor lists
+  std::vector<Particle *> _particles;
+
+  /// verlet lists in compressed sparse row format, empty if compact lists are used
+  CSRNeighborLists<size_t> _neighborLists;
 
-  /// verlet list for SoA:
-  std::vector<std::vector<size_t, autopas::AlignedAllocator<size_t>>> _soaNeighborLists;
+  /// verlet lists in compressed sparse row format with 32 bit indices, only used if _useCompactNeighborLists is true
+  CSRNeighborLists<uint32_t> _compactNeighborLists;
 
-  // specifies if the SoA neighbor list is currently valid
-  bool _soaListIsValid;
+  /// specifies if the AoS neighbor list is currently valid
+  bool _aosListIsValid;
 
   /// specifies how the verlet lists are build
   BuildVerletListType _buildVerletListType;
+
+  /// absolute displacement below which the lists of calm cells are kept, zero disables incremental rebuilds
+  double _incrementalRebuildThreshold;
+
+  /// specifies whether the neighbor lists store 32 bit indices
+  bool _useCompactNeighborLists;
+
+  /// cell offsets of the previous rebuild, empty if there was none with incremental rebuilds
+  std::vector<size_t> _referenceCellOffsets;
+
+  /// reference position of every particle for incremental rebuilds
+  std::vector<std::array<double, 3>> _referencePositions;
+
+  /// id of every particle at the previous rebuild
+  std::vector<typename Particle::ParticleIdType> _referenceIds;
+
+  /// whether the previous rebuild used newton3
+  bool _referenceNewton3{false};
 };
 
 }  // namespace autopas
@@ -11,6 +11,7 @@
 #include "autopas/containers/cellPairTraversals/CellPairTraversal.h"
 #include "autopas/containers/verletListsCellBased/verletLists/VerletListHelpers.h"
 #include "autopas/options/DataLayoutOption.h"
+#include "autopas/utils/TraceRecorder.h"
 
 namespace autopas {
 
@@ -70,33 +71,46 @@ class TraversalVerlet
   }
 
   void traverseParticlePairs() override {
-    auto &aosNeighborLists = *(this->_aosNeighborLists);
-    auto &soaNeighborLists = *(this->_soaNeighborLists);
+    if (this->_compactNeighborLists) {
+      traverseNeighborLists(*(this->_compactNeighborLists));
+    } else {
+      traverseNeighborLists(*(this->_neighborLists));
+    }
+  }
+
+ private:
+  /**
+   * Applies the functor to all pairs in the given neighbor lists.
+   * @tparam NeighborListsType CSRNeighborLists of any index type.
+   * @param neighborLists
+   */
+  template <class NeighborListsType>
+  void traverseNeighborLists(const NeighborListsType &neighborLists) {
+    auto &particles = *(this->_particles);
     switch (dataLayout) {
       case DataLayoutOption::aos: {
 #if defined(AUTOPAS_OPENMP)
         if (not useNewton3) {
-          size_t buckets = aosNeighborLists.bucket_count();
-          // @todo find a sensible chunk size
-#pragma omp parallel for schedule(dynamic)
-          for (size_t b = 0; b < buckets; b++) {
-            auto endIter = aosNeighborLists.end(b);
-            for (auto it = aosNeighborLists.begin(b); it != endIter; ++it) {
-              Particle &i = *(it->first);
-              for (auto j_ptr : it->second) {
-                Particle &j = *j_ptr;
-                _functor->AoSFunctor(i, j, false);
+#pragma omp parallel
+          {
+            utils::TraceScope traceLists("neighbor lists");
+            // the schedule is set by the AutoTuner according to the current configuration
+#pragma omp for schedule(runtime) nowait
+            for (size_t i = 0; i < neighborLists.size(); ++i) {
+              Particle &particleI = *particles[i];
+              for (auto j : neighborLists[i]) {
+                _functor->AoSFunctor(particleI, *particles[j], false);
               }
             }
           }
         } else
 #endif
         {
-          for (auto &list : aosNeighborLists) {
-            Particle &i = *list.first;
-            for (auto j_ptr : list.second) {
-              Particle &j = *j_ptr;
-              _functor->AoSFunctor(i, j, useNewton3);
+          utils::TraceScope traceLists("neighbor lists");
+          for (size_t i = 0; i < neighborLists.size(); ++i) {
+            Particle &particleI = *particles[i];
+            for (auto j : neighborLists[i]) {
+              _functor->AoSFunctor(particleI, *particles[j], useNewton3);
             }
           }
         }
@@ -105,21 +119,26 @@ class TraversalVerlet
 
       case DataLayoutOption::soa: {
         const size_t iFrom = 0;
-        const size_t iTo = soaNeighborLists.size();
+        const size_t iTo = neighborLists.size();
 
 #if defined(AUTOPAS_OPENMP)
         if (not useNewton3) {
           // @todo find a sensible chunk size
           const size_t chunkSize = std::max((iTo - iFrom) / (omp_get_max_threads() * 10), 1ul);
-#pragma omp parallel for schedule(dynamic, chunkSize)
-          for (size_t i = iFrom; i < iTo; i++) {
-            _functor->SoAFunctor(_soa, soaNeighborLists, i, i + 1, useNewton3);
+#pragma omp parallel
+          {
+            utils::TraceScope traceLists("neighbor lists");
+#pragma omp for schedule(dynamic, chunkSize) nowait
+            for (size_t i = iFrom; i < iTo; i++) {
+              _functor->SoAFunctor(_soa, neighborLists, i, i + 1, useNewton3);
+            }
           }
         } else
 #endif
         {
+          utils::TraceScope traceLists("neighbor lists");
           // iterate over SoA
-          _functor->SoAFunctor(_soa, soaNeighborLists, iFrom, iTo, useNewton3);
+          _functor->SoAFunctor(_soa, neighborLists, iFrom, iTo, useNewton3);
         }
         return;
       }
@@ -129,7 +148,6 @@ class TraversalVerlet
     }
   }
 
- private:
   /**
    * Functor for Traversal
    */
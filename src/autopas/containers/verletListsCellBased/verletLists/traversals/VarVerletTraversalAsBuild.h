@@ -9,6 +9,7 @@
 #include "autopas/containers/verletListsCellBased/verletLists/neighborLists/asBuild/VerletNeighborListAsBuild.h"
 #include "autopas/containers/verletListsCellBased/verletLists/traversals/VarVerletTraversalInterface.h"
 #include "autopas/options/TraversalOption.h"
+#include "autopas/utils/TraceRecorder.h"
 #include "autopas/utils/WrapOpenMP.h"
 
 namespace autopas {
@@ -108,17 +109,26 @@ void VarVerletTraversalAsBuild<ParticleCell, Particle, PairwiseFunctor, dataLayo
   {
     constexpr int numColors = 8;
     for (int c = 0; c < numColors; c++) {
+      {
+        utils::TraceScope traceColor("color", c);
 #if defined(AUTOPAS_OPENMP)
-#pragma omp for schedule(static)
+#pragma omp for schedule(static) nowait
 #endif
-      for (unsigned int thread = 0; thread < list[c].size(); thread++) {
-        const auto &currentParticleToNeighborMap = list[c][thread];
-        for (const auto &[currentParticle, neighborParticles] : currentParticleToNeighborMap) {
-          for (auto neighborParticle : neighborParticles) {
-            _functor->AoSFunctor(*(currentParticle), *neighborParticle, useNewton3);
+        for (unsigned int thread = 0; thread < list[c].size(); thread++) {
+          const auto &currentParticleToNeighborMap = list[c][thread];
+          for (const auto &[currentParticle, neighborParticles] : currentParticleToNeighborMap) {
+            for (auto neighborParticle : neighborParticles) {
+              _functor->AoSFunctor(*(currentParticle), *neighborParticle, useNewton3);
+            }
           }
         }
       }
+#if defined(AUTOPAS_OPENMP)
+      {
+        utils::TraceScope traceBarrier("barrier", c);
+#pragma omp barrier
+      }
+#endif
     }
   }
 }
@@ -135,13 +145,22 @@ void VarVerletTraversalAsBuild<ParticleCell, Particle, PairwiseFunctor, dataLayo
   {
     constexpr int numColors = 8;
     for (int color = 0; color < numColors; color++) {
+      {
+        utils::TraceScope traceColor("color", color);
 #if defined(AUTOPAS_OPENMP)
-#pragma omp for schedule(static)
+#pragma omp for schedule(static) nowait
 #endif
-      for (unsigned int thread = 0; thread < soaNeighborList[color].size(); thread++) {
-        const auto &threadNeighborList = soaNeighborList[color][thread];
-        _functor->SoAFunctor(*_soa, threadNeighborList, 0, threadNeighborList.size(), useNewton3);
+        for (unsigned int thread = 0; thread < soaNeighborList[color].size(); thread++) {
+          const auto &threadNeighborList = soaNeighborList[color][thread];
+          _functor->SoAFunctor(*_soa, threadNeighborList, 0, threadNeighborList.size(), useNewton3);
+        }
       }
+#if defined(AUTOPAS_OPENMP)
+      {
+        utils::TraceScope traceBarrier("barrier", color);
+#pragma omp barrier
+      }
+#endif
     }
   }
 }
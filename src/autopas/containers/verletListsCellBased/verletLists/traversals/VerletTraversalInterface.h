@@ -9,6 +9,7 @@
 #include "autopas/containers/cellPairTraversals/CellPairTraversal.h"
 #include "autopas/containers/verletListsCellBased/verletLists/VerletListHelpers.h"
 #include "autopas/options/DataLayoutOption.h"
+#include "autopas/utils/CSRNeighborLists.h"
 
 namespace autopas {
 
@@ -29,17 +30,31 @@ class VerletTraversalInterface {
   /**
    * Sets the information the traversal needs for the iteration.
    * @param cells The cells of the underlying LinkedCells container.
-   * @param aosNeighborLists The AoS neighbor list.
-   * @param soaNeighborLists The SoA neighbor list.
+   * @param particles All particles in the order of their index in the neighbor lists.
+   * @param neighborLists The neighbor lists in compressed sparse row format.
    */
-  virtual void setCellsAndNeighborLists(
-      std::vector<LinkedParticleCell> &cells,
-      std::unordered_map<typename LinkedParticleCell::ParticleType *,
-                         std::vector<typename LinkedParticleCell::ParticleType *>> &aosNeighborLists,
-      std::vector<std::vector<size_t, autopas::AlignedAllocator<size_t>>> &soaNeighborLists) {
+  virtual void setCellsAndNeighborLists(std::vector<LinkedParticleCell> &cells,
+                                        std::vector<typename LinkedParticleCell::ParticleType *> &particles,
+                                        CSRNeighborLists<size_t> &neighborLists) {
     _cells = &cells;
-    _aosNeighborLists = &aosNeighborLists;
-    _soaNeighborLists = &soaNeighborLists;
+    _particles = &particles;
+    _neighborLists = &neighborLists;
+    _compactNeighborLists = nullptr;
+  }
+
+  /**
+   * Sets the information the traversal needs for the iteration.
+   * @param cells The cells of the underlying LinkedCells container.
+   * @param particles All particles in the order of their index in the neighbor lists.
+   * @param compactNeighborLists The neighbor lists in compressed sparse row format with 32 bit indices.
+   */
+  virtual void setCellsAndNeighborLists(std::vector<LinkedParticleCell> &cells,
+                                        std::vector<typename LinkedParticleCell::ParticleType *> &particles,
+                                        CSRNeighborLists<uint32_t> &compactNeighborLists) {
+    _cells = &cells;
+    _particles = &particles;
+    _neighborLists = nullptr;
+    _compactNeighborLists = &compactNeighborLists;
   }
 
  protected:
@@ -48,14 +63,17 @@ class VerletTraversalInterface {
    */
   std::vector<LinkedParticleCell> *_cells;
   /**
-   * The AoS neighbor list of the verlet lists container.
+   * All particles of the verlet lists container in the order of their index in the neighbor lists.
+   */
+  std::vector<typename LinkedParticleCell::ParticleType *> *_particles;
+  /**
+   * The neighbor lists of the verlet lists container. Null if the container uses compact neighbor lists.
    */
-  std::unordered_map<typename LinkedParticleCell::ParticleType *,
-                     std::vector<typename LinkedParticleCell::ParticleType *>> *_aosNeighborLists;
+  CSRNeighborLists<size_t> *_neighborLists{nullptr};
   /**
-   * The SoA neighbor list of the verlet lists container.
+   * The compact neighbor lists of the verlet lists container. Null unless the container uses compact neighbor lists.
    */
-  std::vector<std::vector<size_t, autopas::AlignedAllocator<size_t>>> *_soaNeighborLists;
+  CSRNeighborLists<uint32_t> *_compactNeighborLists{nullptr};
 };
 
 }  // namespace autopas
\ No newline at end of file
@@ -69,9 +69,7 @@ class VerletListsCells
                                                   traversal->getTraversalType());
     }
 
-    traversal->initTraversal();
-    traversal->traverseParticlePairs();
-    traversal->endTraversal();
+    traversal->runTraversal();
   }
 
   /**
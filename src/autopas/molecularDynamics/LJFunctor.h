@@ -485,19 +485,31 @@ class LJFunctor
   void SoAFunctor(SoAView<SoAArraysType> soa,
                   const std::vector<std::vector<size_t, autopas::AlignedAllocator<size_t>>> &neighborList, size_t iFrom,
                   size_t iTo, const bool newton3) override {
-    if (newton3) {
-      if (_duplicatedCalculations) {
-        SoAFunctorImpl<true, true>(soa, neighborList, iFrom, iTo);
-      } else {
-        SoAFunctorImpl<true, false>(soa, neighborList, iFrom, iTo);
-      }
-    } else {
-      if (_duplicatedCalculations) {
-        SoAFunctorImpl<false, true>(soa, neighborList, iFrom, iTo);
-      } else {
-        SoAFunctorImpl<false, false>(soa, neighborList, iFrom, iTo);
-      }
-    }
+    SoAFunctorVerlet(soa, neighborList, iFrom, iTo, newton3);
+  }
+
+  // clang-format off
+  /**
+   * @copydoc Functor::SoAFunctor(SoAView<SoAArraysType> soa, const CSRNeighborLists<size_t> &neighborList, size_t iFrom, size_t iTo, bool newton3)
+   * @note If you want to parallelize this by openmp, please ensure that there
+   * are no dependencies, i.e. introduce colors and specify iFrom and iTo accordingly.
+   */
+  // clang-format on
+  void SoAFunctor(SoAView<SoAArraysType> soa, const CSRNeighborLists<size_t> &neighborList, size_t iFrom, size_t iTo,
+                  const bool newton3) override {
+    SoAFunctorVerlet(soa, neighborList, iFrom, iTo, newton3);
+  }
+
+  // clang-format off
+  /**
+   * @copydoc Functor::SoAFunctor(SoAView<SoAArraysType> soa, const CSRNeighborLists<uint32_t> &neighborList, size_t iFrom, size_t iTo, bool newton3)
+   * @note If you want to parallelize this by openmp, please ensure that there
+   * are no dependencies, i.e. introduce colors and specify iFrom and iTo accordingly.
+   */
+  // clang-format on
+  void SoAFunctor(SoAView<SoAArraysType> soa, const CSRNeighborLists<uint32_t> &neighborList, size_t iFrom,
+                  size_t iTo, const bool newton3) override {
+    SoAFunctorVerlet(soa, neighborList, iFrom, iTo, newton3);
   }
 
   /**
@@ -804,10 +816,35 @@ class LJFunctor
   SoAFloatPrecision getSigmaSquare() const { return _sigmasquare; }
 
  private:
-  template <bool newton3, bool duplicatedCalculations>
-  void SoAFunctorImpl(SoAView<SoAArraysType> &soa,
-                      const std::vector<std::vector<size_t, autopas::AlignedAllocator<size_t>>> &neighborList,
-                      size_t iFrom, size_t iTo) {
+  /**
+   * Dispatches the verlet SoAFunctor to the implementation matching newton3 and _duplicatedCalculations.
+   * @tparam NeighborListsType Either a vector of neighbor lists or CSRNeighborLists.
+   * @param soa
+   * @param neighborList
+   * @param iFrom
+   * @param iTo
+   * @param newton3
+   */
+  template <class NeighborListsType>
+  void SoAFunctorVerlet(SoAView<SoAArraysType> &soa, const NeighborListsType &neighborList, size_t iFrom, size_t iTo,
+                        const bool newton3) {
+    if (newton3) {
+      if (_duplicatedCalculations) {
+        SoAFunctorImpl<true, true>(soa, neighborList, iFrom, iTo);
+      } else {
+        SoAFunctorImpl<true, false>(soa, neighborList, iFrom, iTo);
+      }
+    } else {
+      if (_duplicatedCalculations) {
+        SoAFunctorImpl<false, true>(soa, neighborList, iFrom, iTo);
+      } else {
+        SoAFunctorImpl<false, false>(soa, neighborList, iFrom, iTo);
+      }
+    }
+  }
+
+  template <bool newton3, bool duplicatedCalculations, class NeighborListsType>
+  void SoAFunctorImpl(SoAView<SoAArraysType> &soa, const NeighborListsType &neighborList, size_t iFrom, size_t iTo) {
     if (soa.getNumParticles() == 0) return;
 
     const auto *const __restrict__ xptr = soa.template begin<Particle::AttributeNames::posX>();
@@ -837,7 +874,7 @@ class LJFunctor
       SoAFloatPrecision fyacc = 0;
       SoAFloatPrecision fzacc = 0;
       const size_t listSizeI = neighborList[i].size();
-      const size_t *const __restrict__ currentList = neighborList[i].data();
+      const auto *const __restrict__ currentList = neighborList[i].data();
 
       // checks whether particle 1 is in the domain box, unused if _duplicatedCalculations is false!
       SoAFloatPrecision inbox1Mul = 0.;
@@ -546,6 +546,26 @@ class LJFunctorAVX : public Functor<Particle, ParticleCell, typename Particle::S
     utils::ExceptionHandler::exception("Verlet SoA functor not implemented!");
   }
 
+  // clang-format off
+  /**
+   * @copydoc Functor::SoAFunctor(SoAView<SoAArraysType> soa, const CSRNeighborLists<size_t> &neighborList, size_t iFrom, size_t iTo, bool newton3)
+   */
+  // clang-format on
+  void SoAFunctor(SoAView<SoAArraysType> soa, const CSRNeighborLists<size_t> &neighborList, size_t iFrom, size_t iTo,
+                  bool newton3) override {
+    utils::ExceptionHandler::exception("Verlet SoA functor not implemented!");
+  }
+
+  // clang-format off
+  /**
+   * @copydoc Functor::SoAFunctor(SoAView<SoAArraysType> soa, const CSRNeighborLists<uint32_t> &neighborList, size_t iFrom, size_t iTo, bool newton3)
+   */
+  // clang-format on
+  void SoAFunctor(SoAView<SoAArraysType> soa, const CSRNeighborLists<uint32_t> &neighborList, size_t iFrom,
+                  size_t iTo, bool newton3) override {
+    utils::ExceptionHandler::exception("Verlet SoA functor not implemented!");
+  }
+
   /**
    * @copydoc Functor::getNeededAttr()
    */
@@ -0,0 +1,70 @@
+/**
+ * @file ScheduleOption.h
+ * @author F. Gratl
+ * @date 16.10.26
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "autopas/options/Option.h"
+
+namespace autopas {
+
+/**
+ * Class representing the OpenMP loop schedule kinds the traversals can use.
+ */
+class ScheduleOption : public Option<ScheduleOption> {
+ public:
+  /**
+   * Possible choices for the loop schedule.
+   */
+  enum Value {
+    /**
+     * Iterations are split into chunks which are assigned round-robin to the threads.
+     */
+    staticSchedule,
+    /**
+     * Threads grab the next chunk whenever they are done with their current one.
+     */
+    dynamicSchedule,
+    /**
+     * Like dynamic but the chunk size shrinks with the number of remaining iterations.
+     */
+    guidedSchedule
+  };
+
+  /**
+   * Constructor.
+   */
+  ScheduleOption() = default;
+
+  /**
+   * Constructor from value.
+   * @param option
+   */
+  constexpr ScheduleOption(Value option) : _value(option) {}
+
+  /**
+   * Cast to value.
+   * @return
+   */
+  constexpr operator Value() const { return _value; }
+
+  /**
+   * Provides a way to iterate over the possible choices of ScheduleOption.
+   * @return map option -> string representation
+   */
+  static std::map<ScheduleOption, std::string> getOptionNames() {
+    return {
+        {ScheduleOption::staticSchedule, "static"},
+        {ScheduleOption::dynamicSchedule, "dynamic"},
+        {ScheduleOption::guidedSchedule, "guided"},
+    };
+  };
+
+ private:
+  Value _value{Value(-1)};
+};
+}  // namespace autopas
@@ -0,0 +1,65 @@
+/**
+ * @file TelemetryFormatOption.h
+ * @author F. Gratl
+ * @date 17.10.26
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "autopas/options/Option.h"
+
+namespace autopas {
+
+/**
+ * Class representing the file formats the per iteration telemetry can be written in.
+ */
+class TelemetryFormatOption : public Option<TelemetryFormatOption> {
+ public:
+  /**
+   * Possible choices for the telemetry format.
+   */
+  enum Value {
+    /**
+     * Comma separated values with a header line.
+     */
+    csv,
+    /**
+     * One JSON object per line.
+     */
+    jsonLines
+  };
+
+  /**
+   * Constructor.
+   */
+  TelemetryFormatOption() = default;
+
+  /**
+   * Constructor from value.
+   * @param option
+   */
+  constexpr TelemetryFormatOption(Value option) : _value(option) {}
+
+  /**
+   * Cast to value.
+   * @return
+   */
+  constexpr operator Value() const { return _value; }
+
+  /**
+   * Provides a way to iterate over the possible choices of TelemetryFormatOption.
+   * @return map option -> string representation
+   */
+  static std::map<TelemetryFormatOption, std::string> getOptionNames() {
+    return {
+        {TelemetryFormatOption::csv, "csv"},
+        {TelemetryFormatOption::jsonLines, "json-lines"},
+    };
+  };
+
+ private:
+  Value _value{Value(-1)};
+};
+}  // namespace autopas
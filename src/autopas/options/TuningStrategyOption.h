@@ -38,6 +38,14 @@ class TuningStrategyOption : public Option<TuningStrategyOption> {
      * ActiveHarmony client / server system
      */
     activeHarmony,
+    /**
+     * Test all configurations once, then repeatedly discard the slower half and test the rest again.
+     */
+    successiveHalving,
+    /**
+     * Test configurations in the order of their estimated cost and calibrate the estimate with every measurement.
+     */
+    costModelSearch,
   };
 
   /**
@@ -67,6 +75,8 @@ class TuningStrategyOption : public Option<TuningStrategyOption> {
         {TuningStrategyOption::fullSearch, "full-Search"},
         {TuningStrategyOption::randomSearch, "random-Search"},
         {TuningStrategyOption::activeHarmony, "active-harmony"},
+        {TuningStrategyOption::successiveHalving, "successive-halving"},
+        {TuningStrategyOption::costModelSearch, "cost-model-search"},
     };
   };
 
@@ -145,117 +145,17 @@ class FlopCounterFunctor : public Functor<Particle, ParticleCell, typename Parti
   void SoAFunctor(SoAView<typename Particle::SoAArraysType> soa,
                   const std::vector<std::vector<size_t, autopas::AlignedAllocator<size_t>>> &neighborList, size_t iFrom,
                   size_t iTo, bool newton3) override {
-    auto numParts = soa.getNumParticles();
-
-    if (numParts == 0) return;
-
-    double *const __restrict__ xptr = soa.template begin<Particle::AttributeNames::posX>();
-    double *const __restrict__ yptr = soa.template begin<Particle::AttributeNames::posY>();
-    double *const __restrict__ zptr = soa.template begin<Particle::AttributeNames::posZ>();
-
-    for (size_t i = iFrom; i < iTo; ++i) {
-      const size_t listSizeI = neighborList[i].size();
-      const size_t *const __restrict__ currentList = neighborList[i].data();
-
-      // this is a magic number, that should correspond to at least
-      // vectorization width*N have testet multiple sizes:
-      // 4: small speedup compared to AoS
-      // 8: small speedup compared to AoS
-      // 12: small but best speedup compared to Aos
-      // 16: smaller speedup
-      // in theory this is a variable, we could auto-tune over...
-#ifdef __AVX512F__
-      // use a multiple of 8 for avx
-      const size_t vecsize = 16;
-#else
-      // for everything else 12 is faster
-      const size_t vecsize = 12;
-#endif
-      size_t joff = 0;
-
-      // if the size of the verlet list is larger than the given size vecsize,
-      // we will use a vectorized version.
-      if (listSizeI >= vecsize) {
-        alignas(64) std::array<double, vecsize> xtmp{}, ytmp{}, ztmp{}, xArr{}, yArr{}, zArr{};
-        // broadcast of the position of particle i
-        for (size_t tmpj = 0; tmpj < vecsize; tmpj++) {
-          xtmp[tmpj] = xptr[i];
-          ytmp[tmpj] = yptr[i];
-          ztmp[tmpj] = zptr[i];
-        }
-        // loop over the verlet list from 0 to x*vecsize
-        for (; joff < listSizeI - vecsize + 1; joff += vecsize) {
-          unsigned long distanceCalculationsAcc = 0;
-          unsigned long kernelCallsAcc = 0;
-          // in each iteration we calculate the interactions of particle i with
-          // vecsize particles in the neighborlist of particle i starting at
-          // particle joff
-
-          // gather position of particle j
-#pragma omp simd safelen(vecsize)
-          for (size_t tmpj = 0; tmpj < vecsize; tmpj++) {
-            xArr[tmpj] = xptr[currentList[joff + tmpj]];
-            yArr[tmpj] = yptr[currentList[joff + tmpj]];
-            zArr[tmpj] = zptr[currentList[joff + tmpj]];
-          }
-
-          // do omp simd with reduction of the interaction
-#pragma omp simd reduction(+ : kernelCallsAcc, distanceCalculationsAcc) safelen(vecsize)
-          for (size_t j = 0; j < vecsize; j++) {
-            ++distanceCalculationsAcc;
-            const double drx = xtmp[j] - xArr[j];
-            const double dry = ytmp[j] - yArr[j];
-            const double drz = ztmp[j] - zArr[j];
-
-            const double drx2 = drx * drx;
-            const double dry2 = dry * dry;
-            const double drz2 = drz * drz;
-
-            const double dr2 = drx2 + dry2 + drz2;
-
-            const unsigned long mask = (dr2 <= _cutoffSquare) ? 1 : 0;
-
-            kernelCallsAcc += mask;
-          }
-#ifdef AUTOPAS_OPENMP
-#pragma omp critical
-#endif
-          {
-            _distanceCalculations += distanceCalculationsAcc;
-            _kernelCalls += kernelCallsAcc;
-          }
-        }
-      }
-      unsigned long distanceCalculationsAcc = 0;
-      unsigned long kernelCallsAcc = 0;
-      // this loop goes over the remainder and uses no optimizations
-      for (size_t jNeighIndex = joff; jNeighIndex < listSizeI; ++jNeighIndex) {
-        size_t j = neighborList[i][jNeighIndex];
-        if (i == j) continue;
-
-        ++distanceCalculationsAcc;
-        const double drx = xptr[i] - xptr[j];
-        const double dry = yptr[i] - yptr[j];
-        const double drz = zptr[i] - zptr[j];
-
-        const double drx2 = drx * drx;
-        const double dry2 = dry * dry;
-        const double drz2 = drz * drz;
+    SoAFunctorVerletImpl(soa, neighborList, iFrom, iTo);
+  }
 
-        const double dr2 = drx2 + dry2 + drz2;
+  void SoAFunctor(SoAView<typename Particle::SoAArraysType> soa, const CSRNeighborLists<size_t> &neighborList,
+                  size_t iFrom, size_t iTo, bool newton3) override {
+    SoAFunctorVerletImpl(soa, neighborList, iFrom, iTo);
+  }
 
-        if (dr2 <= _cutoffSquare) {
-          ++kernelCallsAcc;
-        }
-      }
-#ifdef AUTOPAS_OPENMP
-#pragma omp critical
-#endif
-      {
-        _distanceCalculations += distanceCalculationsAcc;
-        _kernelCalls += kernelCallsAcc;
-      }
-    }
+  void SoAFunctor(SoAView<typename Particle::SoAArraysType> soa, const CSRNeighborLists<uint32_t> &neighborList,
+                  size_t iFrom, size_t iTo, bool newton3) override {
+    SoAFunctorVerletImpl(soa, neighborList, iFrom, iTo);
   }
 
   void CudaFunctor(CudaSoA<typename Particle::CudaDeviceArraysType> &device_handle, bool newton3) override {
@@ -390,6 +290,130 @@ class FlopCounterFunctor : public Functor<Particle, ParticleCell, typename Parti
   static constexpr double numFlopsPerDistanceCalculation = 8.0;
 
  private:
+  /**
+   * Counts the distance calculations and kernel calls of the verlet SoAFunctor.
+   * @tparam NeighborListsType Either a vector of neighbor lists or CSRNeighborLists.
+   * @param soa
+   * @param neighborList
+   * @param iFrom
+   * @param iTo
+   */
+  template <class NeighborListsType>
+  void SoAFunctorVerletImpl(SoAView<typename Particle::SoAArraysType> &soa, const NeighborListsType &neighborList,
+                            size_t iFrom, size_t iTo) {
+    auto numParts = soa.getNumParticles();
+
+    if (numParts == 0) return;
+
+    double *const __restrict__ xptr = soa.template begin<Particle::AttributeNames::posX>();
+    double *const __restrict__ yptr = soa.template begin<Particle::AttributeNames::posY>();
+    double *const __restrict__ zptr = soa.template begin<Particle::AttributeNames::posZ>();
+
+    for (size_t i = iFrom; i < iTo; ++i) {
+      const size_t listSizeI = neighborList[i].size();
+      const auto *const __restrict__ currentList = neighborList[i].data();
+
+      // this is a magic number, that should correspond to at least
+      // vectorization width*N have testet multiple sizes:
+      // 4: small speedup compared to AoS
+      // 8: small speedup compared to AoS
+      // 12: small but best speedup compared to Aos
+      // 16: smaller speedup
+      // in theory this is a variable, we could auto-tune over...
+#ifdef __AVX512F__
+      // use a multiple of 8 for avx
+      const size_t vecsize = 16;
+#else
+      // for everything else 12 is faster
+      const size_t vecsize = 12;
+#endif
+      size_t joff = 0;
+
+      // if the size of the verlet list is larger than the given size vecsize,
+      // we will use a vectorized version.
+      if (listSizeI >= vecsize) {
+        alignas(64) std::array<double, vecsize> xtmp{}, ytmp{}, ztmp{}, xArr{}, yArr{}, zArr{};
+        // broadcast of the position of particle i
+        for (size_t tmpj = 0; tmpj < vecsize; tmpj++) {
+          xtmp[tmpj] = xptr[i];
+          ytmp[tmpj] = yptr[i];
+          ztmp[tmpj] = zptr[i];
+        }
+        // loop over the verlet list from 0 to x*vecsize
+        for (; joff < listSizeI - vecsize + 1; joff += vecsize) {
+          unsigned long distanceCalculationsAcc = 0;
+          unsigned long kernelCallsAcc = 0;
+          // in each iteration we calculate the interactions of particle i with
+          // vecsize particles in the neighborlist of particle i starting at
+          // particle joff
+
+          // gather position of particle j
+#pragma omp simd safelen(vecsize)
+          for (size_t tmpj = 0; tmpj < vecsize; tmpj++) {
+            xArr[tmpj] = xptr[currentList[joff + tmpj]];
+            yArr[tmpj] = yptr[currentList[joff + tmpj]];
+            zArr[tmpj] = zptr[currentList[joff + tmpj]];
+          }
+
+          // do omp simd with reduction of the interaction
+#pragma omp simd reduction(+ : kernelCallsAcc, distanceCalculationsAcc) safelen(vecsize)
+          for (size_t j = 0; j < vecsize; j++) {
+            ++distanceCalculationsAcc;
+            const double drx = xtmp[j] - xArr[j];
+            const double dry = ytmp[j] - yArr[j];
+            const double drz = ztmp[j] - zArr[j];
+
+            const double drx2 = drx * drx;
+            const double dry2 = dry * dry;
+            const double drz2 = drz * drz;
+
+            const double dr2 = drx2 + dry2 + drz2;
+
+            const unsigned long mask = (dr2 <= _cutoffSquare) ? 1 : 0;
+
+            kernelCallsAcc += mask;
+          }
+#ifdef AUTOPAS_OPENMP
+#pragma omp critical
+#endif
+          {
+            _distanceCalculations += distanceCalculationsAcc;
+            _kernelCalls += kernelCallsAcc;
+          }
+        }
+      }
+      unsigned long distanceCalculationsAcc = 0;
+      unsigned long kernelCallsAcc = 0;
+      // this loop goes over the remainder and uses no optimizations
+      for (size_t jNeighIndex = joff; jNeighIndex < listSizeI; ++jNeighIndex) {
+        size_t j = neighborList[i][jNeighIndex];
+        if (i == j) continue;
+
+        ++distanceCalculationsAcc;
+        const double drx = xptr[i] - xptr[j];
+        const double dry = yptr[i] - yptr[j];
+        const double drz = zptr[i] - zptr[j];
+
+        const double drx2 = drx * drx;
+        const double dry2 = dry * dry;
+        const double drz2 = drz * drz;
+
+        const double dr2 = drx2 + dry2 + drz2;
+
+        if (dr2 <= _cutoffSquare) {
+          ++kernelCallsAcc;
+        }
+      }
+#ifdef AUTOPAS_OPENMP
+#pragma omp critical
+#endif
+      {
+        _distanceCalculations += distanceCalculationsAcc;
+        _kernelCalls += kernelCallsAcc;
+      }
+    }
+  }
+
   double _cutoffSquare;
   unsigned long _distanceCalculations, _kernelCalls;
 };
@@ -12,6 +12,7 @@
 #include "autopas/cells/ParticleCell.h"
 #include "autopas/options/DataLayoutOption.h"
 #include "autopas/utils/AlignedAllocator.h"
+#include "autopas/utils/CSRNeighborLists.h"
 #include "autopas/utils/CudaSoA.h"
 #include "autopas/utils/ExceptionHandler.h"
 #include "autopas/utils/SoAView.h"
@@ -176,6 +177,38 @@ class Functor {
     utils::ExceptionHandler::exception("Functor::SoAFunctor(verlet): not yet implemented");
   }
 
+  /**
+   * @brief Functor for structure of arrays (SoA) for neighbor lists in compressed sparse row format
+   *
+   * Same as the SoAFunctor for a vector of neighbor lists, but all lists are stored in one contiguous array.
+   *
+   * @param soa Structure of arrays
+   * @param neighborList The lists of neighbors
+   * @param iFrom the first particle whose list should be iterated over
+   * @param iTo the first particle whose list should not be iterated over
+   * @param newton3 defines whether or whether not to use newton 3
+   */
+  virtual void SoAFunctor(SoAView<SoAArraysType> soa, const CSRNeighborLists<size_t> &neighborList, size_t iFrom,
+                          size_t iTo, bool newton3) {
+    utils::ExceptionHandler::exception("Functor::SoAFunctor(verlet csr): not yet implemented");
+  }
+
+  /**
+   * @brief Functor for structure of arrays (SoA) for compact neighbor lists in compressed sparse row format
+   *
+   * Same as the SoAFunctor for neighbor lists in compressed sparse row format, but the indices only take 32 bits.
+   *
+   * @param soa Structure of arrays
+   * @param neighborList The lists of neighbors
+   * @param iFrom the first particle whose list should be iterated over
+   * @param iTo the first particle whose list should not be iterated over
+   * @param newton3 defines whether or whether not to use newton 3
+   */
+  virtual void SoAFunctor(SoAView<SoAArraysType> soa, const CSRNeighborLists<uint32_t> &neighborList, size_t iFrom,
+                          size_t iTo, bool newton3) {
+    utils::ExceptionHandler::exception("Functor::SoAFunctor(verlet compact csr): not yet implemented");
+  }
+
   /**
    * @brief Functor for structure of arrays (SoA)
    *
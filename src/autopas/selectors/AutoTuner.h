@@ -6,20 +6,39 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <cmath>
+#include <limits>
+#include <map>
 #include <memory>
+#include <optional>
 #include <set>
+#include <string>
+#include <typeinfo>
+#include <utility>
+#include <vector>
 
 #include "autopas/options/DataLayoutOption.h"
 #include "autopas/options/Newton3Option.h"
 #include "autopas/options/TraversalOption.h"
 #include "autopas/selectors/Configuration.h"
 #include "autopas/selectors/ContainerSelector.h"
+#include "autopas/selectors/DriftMonitor.h"
 #include "autopas/selectors/OptimumSelector.h"
+#include "autopas/selectors/RuleBasedPruning.h"
+#include "autopas/selectors/TelemetryWriter.h"
 #include "autopas/selectors/TraversalSelector.h"
+#include "autopas/selectors/TuningDatabase.h"
+#include "autopas/selectors/TuningRecorder.h"
+#include "autopas/selectors/tuningStrategy/FullSearch.h"
 #include "autopas/selectors/tuningStrategy/TuningStrategyInterface.h"
+#include "autopas/utils/ArrayMath.h"
 #include "autopas/utils/ArrayUtils.h"
+#include "autopas/utils/PerformanceCounters.h"
+#include "autopas/utils/ScopedOpenMPSettings.h"
 #include "autopas/utils/Timer.h"
+#include "autopas/utils/inBox.h"
 
 namespace autopas {
 
@@ -40,28 +59,79 @@ class AutoTuner {
    * @param boxMin Lower corner of the container.
    * @param boxMax Upper corner of the container.
    * @param cutoff Cutoff radius to be used in this container.
-   * @param verletSkin Length added to the cutoff for the Verlet lists' skin.
-   * @param verletClusterSize Number of particles in a cluster to use in verlet list.
    * @param tuningStrategy Object implementing the modelling and exploration of a search space.
    * @param selectorStrategy Strategy for the configuration selection.
-   * @param tuningInterval Number of time steps after which the auto-tuner shall reevaluate all selections.
-   * @param maxSamples Number of samples that shall be collected for each combination.
+   * @param tuningInterval Number of time steps after which the auto-tuner shall reevaluate all selections. If drift
+   * detection is enabled this is the maximal interval between two tuning phases.
+   * @param numSamples Number of samples that are collected for each configuration at least.
+   * @param tuningDatabaseFile File where results of tuning phases are persisted. If a matching result exists the first
+   * tuning phase is skipped. Empty string disables the database.
+   * @param earlyStoppingFactor A configuration is discarded after its first sample if this sample is slower than the
+   * fastest evidence of the current tuning phase times this factor. Infinity disables early stopping.
+   * @param driftThreshold A tuning phase is started before the end of the tuning interval if the iteration time of the
+   * selected configuration differs by more than this many standard deviations from the time measured directly after
+   * the last tuning phase. Infinity disables drift detection.
+   * @param driftWindowSize Number of iterations used for the reference and the current time of the drift detection.
+   * @param pruningRules Configurations matching any of these rules are skipped in tuning phases. The rules are
+   * evaluated against statistics of the domain taken at the start of every tuning phase.
+   * @param maxSamples Upper bound for the number of samples per configuration. Values below numSamples are raised to
+   * numSamples.
+   * @param relativeConfidenceWidth After numSamples samples, sampling of a configuration continues until the half width
+   * of the 95% confidence interval of its mean relative to the mean is below this value or maxSamples is reached.
+   * Infinity disables adaptive sampling. With adaptive sampling outliers are rejected before the samples are reduced.
+   * @param tuningRecordFile File where all measurements of tuning phases are recorded for offline replay. Empty string
+   * disables recording.
+   * @param tuneFunctorsIndependently If true, only the first relevant functor type drives the tuning strategy. Every
+   * other relevant functor type selects its own traversal, data layout and newton 3 option for the container chosen by
+   * the first one.
+   * @param proxyDomainFraction If below one, every tuning phase first measures all configurations on a scratch copy of
+   * a centered subvolume with this fraction of the domain volume and its halo. The times are scaled to the number of
+   * particles of the full domain and passed to the tuning strategy. Only the numProxyConfirmations fastest
+   * configurations are then sampled on the full domain.
+   * @param numProxyConfirmations Number of configurations of the proxy domain that are confirmed on the full domain.
+   * @param usePerformanceCounters If true, hardware performance counters are read around the neighbor list rebuild and
+   * the traversal of every sample and passed to the tuning strategy together with the time. Ignored if the counters are
+   * unavailable.
+   * @param incrementalRebuildThreshold Fraction of the skin below which VerletLists keep the lists of calm cells on a
+   * rebuild. Zero disables incremental rebuilds.
+   * @param useCompactNeighborLists If true, VerletLists store their neighbor lists with 32 bit indices.
    */
-  AutoTuner(std::array<double, 3> boxMin, std::array<double, 3> boxMax, double cutoff, double verletSkin,
-            unsigned int verletClusterSize, std::unique_ptr<TuningStrategyInterface> tuningStrategy,
-            SelectorStrategyOption selectorStrategy, unsigned int tuningInterval, unsigned int maxSamples)
+  AutoTuner(std::array<double, 3> boxMin, std::array<double, 3> boxMax, double cutoff,
+            std::unique_ptr<TuningStrategyInterface> tuningStrategy, SelectorStrategyOption selectorStrategy,
+            unsigned int tuningInterval, unsigned int numSamples, const std::string &tuningDatabaseFile = "",
+            double earlyStoppingFactor = std::numeric_limits<double>::infinity(),
+            double driftThreshold = std::numeric_limits<double>::infinity(), unsigned int driftWindowSize = 10,
+            std::vector<PruningRule> pruningRules = {}, unsigned int maxSamples = 0,
+            double relativeConfidenceWidth = std::numeric_limits<double>::infinity(),
+            const std::string &tuningRecordFile = "", bool tuneFunctorsIndependently = false,
+            double proxyDomainFraction = 1., unsigned int numProxyConfirmations = 3,
+            bool usePerformanceCounters = false, double incrementalRebuildThreshold = 0.,
+            bool useCompactNeighborLists = false)
       : _selectorStrategy(selectorStrategy),
         _tuningStrategy(std::move(tuningStrategy)),
         _tuningInterval(tuningInterval),
         _iterationsSinceTuning(tuningInterval),  // init to max so that tuning happens in first iteration
-        _containerSelector(boxMin, boxMax, cutoff),
-        _verletSkin(verletSkin),
-        _verletClusterSize(verletClusterSize),
-        _maxSamples(maxSamples),
-        _samples(maxSamples) {
+        _containerSelector(boxMin, boxMax, cutoff, incrementalRebuildThreshold, useCompactNeighborLists),
+        _numSamples(numSamples),
+        _maxSamples(std::max(numSamples, maxSamples)),
+        _relativeConfidenceWidth(relativeConfidenceWidth),
+        _samples(_maxSamples),
+        _tuningDatabase(tuningDatabaseFile.empty() ? nullptr : std::make_unique<TuningDatabase>(tuningDatabaseFile)),
+        _earlyStoppingFactor(earlyStoppingFactor),
+        _driftMonitor(std::isinf(driftThreshold) ? nullptr
+                                                 : std::make_unique<DriftMonitor>(driftThreshold, driftWindowSize)),
+        _pruning(pruningRules.empty() ? nullptr : std::make_unique<RuleBasedPruning>(std::move(pruningRules))),
+        _tuningRecorder(tuningRecordFile.empty() ? nullptr : std::make_unique<TuningRecorder>(tuningRecordFile)),
+        _tuneFunctorsIndependently(tuneFunctorsIndependently),
+        _proxyDomainFraction(proxyDomainFraction),
+        _numProxyConfirmations(std::max(1u, numProxyConfirmations)),
+        _performanceCounters(usePerformanceCounters ? std::make_unique<utils::PerformanceCounters>() : nullptr) {
     if (_tuningStrategy->searchSpaceIsEmpty()) {
       autopas::utils::ExceptionHandler::exception("AutoTuner: Passed tuning strategy has an empty search space.");
     }
+    if (_performanceCounters and not _performanceCounters->isAvailable()) {
+      _performanceCounters.reset();
+    }
 
     selectCurrentContainer();
   }
@@ -124,29 +194,83 @@ class AutoTuner {
       return false;
     }
 
-    return _iterationsSinceTuning >= _tuningInterval and _samples.size() >= _maxSamples;
+    return _iterationsSinceTuning >= _tuningInterval and not needsMoreSamples();
+  }
+
+  /**
+   * Save the runtime of a neighbor list rebuild if the functor drives the tuning strategy.
+   *
+   * Rebuild times are collected separately from the traversal times and amortized over the rebuild frequency when the
+   * samples of a configuration are reduced. This has to be called before addTimeMeasurement() of the same iteration.
+   *
+   * @param pairwiseFunctor
+   * @param time
+   */
+  template <class PairwiseFunctor>
+  void addRebuildTimeMeasurement(PairwiseFunctor &pairwiseFunctor, long time) {
+    if (isLeadingFunctor(pairwiseFunctor) and needsMoreSamples()) {
+      AutoPasLog(trace, "Adding rebuild sample.");
+      _rebuildSamples.push_back(time);
+    }
   }
 
   /**
    * Save the runtime of a given traversal if the functor is relevant for tuning.
    *
-   * Samples are collected and reduced to one single value according to _selectorStrategy. Only then the value is passed
-   * on to the tuning strategy. This function expects that samples of the same configuration are taken consecutively.
+   * Samples are collected until needsMoreSamples() returns false and reduced to one single value according to
+   * _selectorStrategy. With adaptive sampling outliers are removed before the reduction. The rebuild samples of the
+   * configuration are reduced the same way and added, divided by the rebuild frequency, so the value reflects the
+   * average cost of an iteration. Only then the value is passed on to the tuning strategy. This function expects that
+   * samples of the same configuration are taken consecutively.
+   * If functors are tuned independently, times of functors that do not drive the tuning strategy are collected in their
+   * own tuning state.
    * The time argument is a long because std::chrono::duration::count returns a long.
    *
    * @param pairwiseFunctor
-   * @param time
+   * @param time Time of the traversal without neighbor list rebuild.
    */
   template <class PairwiseFunctor>
   void addTimeMeasurement(PairwiseFunctor &pairwiseFunctor, long time) {
-    if (pairwiseFunctor.isRelevantForTuning()) {
-      if (_samples.size() < _maxSamples) {
+    if (isLeadingFunctor(pairwiseFunctor)) {
+      if (needsMoreSamples()) {
         AutoPasLog(trace, "Adding sample.");
         _samples.push_back(time);
+        // the rebuild is only paid every verletRebuildFrequency iterations
+        double amortizedRebuildTime = 0.;
+        if (not _rebuildSamples.empty()) {
+          amortizedRebuildTime = static_cast<double>(OptimumSelector::optimumValue(_rebuildSamples, _selectorStrategy)) /
+                                 _tuningStrategy->getCurrentConfiguration().verletRebuildFrequency;
+        }
+        // configurations that are obviously slower than the fastest one are not sampled further
+        const bool stopEarly = _samples.size() == 1 and needsMoreSamples() and
+                               time + amortizedRebuildTime > _earlyStoppingFactor * _fastestEvidenceInTuningPhase;
         // if this was the last sample:
-        if (_samples.size() == _maxSamples) {
-          auto reducedValue = OptimumSelector::optimumValue(_samples, _selectorStrategy);
+        if (not needsMoreSamples() or stopEarly) {
+          auto reducedValue = static_cast<size_t>(
+              OptimumSelector::optimumValue(adaptiveSampling() ? OptimumSelector::rejectOutliers(_samples) : _samples,
+                                            _selectorStrategy) +
+              amortizedRebuildTime);
+          if (_performanceCounterSamples.numMeasurements > 0) {
+            const auto &configuration = _tuningStrategy->getCurrentConfiguration();
+            AutoPasLog(debug, "Performance counters of {}: {}", configuration.toString(),
+                       _performanceCounterSamples.toString());
+            _tuningStrategy->addPerformanceCounterEvidence(_performanceCounterSamples);
+            _performanceCounterEvidence[configuration] = _performanceCounterSamples;
+          }
           _tuningStrategy->addEvidence(reducedValue);
+          _fastestEvidenceInTuningPhase = std::min(_fastestEvidenceInTuningPhase, static_cast<double>(reducedValue));
+          if (_tuningRecorder) {
+            _tuningRecorder->record({_iteration, _tuningStrategy->getCurrentConfiguration(),
+                                     getContainer()->getNumParticles(), reducedValue, _samples, _rebuildSamples});
+          }
+
+          if (stopEarly) {
+            AutoPasLog(debug, "Stopping sampling of {} early. Sample {} exceeds {} times the fastest evidence {}",
+                       _tuningStrategy->getCurrentConfiguration().toString(), time, _earlyStoppingFactor,
+                       _fastestEvidenceInTuningPhase);
+            // fill up the remaining samples so tune() and willRebuild() treat this configuration as fully sampled
+            _samples.resize(_maxSamples, time);
+          }
 
           // print config, times and reduced value
           if (autopas::Logger::get()->level() <= autopas::Logger::LogLevel::debug) {
@@ -155,12 +279,20 @@ class AutoTuner {
             ss << std::endl << _tuningStrategy->getCurrentConfiguration().toString() << " : [ ";
             // print all timings
             ss << utils::ArrayUtils::to_string(_samples, " ");
+            ss << " ] Rebuilds: [ ";
+            ss << utils::ArrayUtils::to_string(_rebuildSamples, " ");
             ss << " ] ";
             ss << "Reduced value: " << reducedValue;
             AutoPasLog(debug, "Collected times for  {}", ss.str());
           }
         }
       }
+    } else if (pairwiseFunctor.isRelevantForTuning()) {
+      auto &functorTuningState = _functorTuningStates[typeid(PairwiseFunctor).name()];
+      if (functorTuningState.isTuning) {
+        AutoPasLog(trace, "Adding sample for functor {}.", typeid(PairwiseFunctor).name());
+        functorTuningState.samples.push_back(time);
+      }
     } else {
       AutoPasLog(trace, "Skipping adding of time measurement because functor is not marked relevant.");
     }
@@ -172,6 +304,34 @@ class AutoTuner {
    */
   autopas::Configuration getCurrentConfig() const;
 
+  /**
+   * Get the configuration and timings of the last call to iteratePairwise().
+   * The particle counts and the container update time are not known to the AutoTuner and left at zero.
+   * @return
+   */
+  const IterationTelemetry &getLastIterationTelemetry() const { return _lastIterationTelemetry; }
+
+  /**
+   * Get the hardware performance counters of the last measurement of every configuration, summed over all its samples.
+   * Empty if performance counters are disabled or unavailable.
+   * @return
+   */
+  const std::map<Configuration, utils::PerformanceCounterValues> &getPerformanceCounterEvidence() const {
+    return _performanceCounterEvidence;
+  }
+
+  /**
+   * Get the configuration the given functor type currently uses.
+   *
+   * This only differs from getCurrentConfig() if functors are tuned independently and the functor type is not the one
+   * driving the tuning strategy.
+   *
+   * @tparam PairwiseFunctor
+   * @return
+   */
+  template <class PairwiseFunctor>
+  autopas::Configuration getFunctorConfig() const;
+
   /**
    * Get the set of all allowed configurations.
    * @return
@@ -184,8 +344,151 @@ class AutoTuner {
    */
   void selectCurrentContainer();
 
+  /**
+   * Checks whether the number of samples adapts to the noise of the measurements.
+   * @return
+   */
+  bool adaptiveSampling() const { return _maxSamples > _numSamples and std::isfinite(_relativeConfidenceWidth); }
+
+  /**
+   * Checks whether the current configuration has to be sampled again.
+   *
+   * At least _numSamples samples are taken. With adaptive sampling, further samples are taken until the confidence
+   * interval of the samples without outliers is narrow enough or _maxSamples is reached.
+   *
+   * @return
+   */
+  bool needsMoreSamples() const {
+    if (_samples.size() < _numSamples) {
+      return true;
+    }
+    if (_samples.size() >= _maxSamples or not adaptiveSampling()) {
+      return false;
+    }
+    return OptimumSelector::relativeConfidenceIntervalWidth(OptimumSelector::rejectOutliers(_samples)) >
+           _relativeConfidenceWidth;
+  }
+
   template <class PairwiseFunctor, DataLayoutOption::Value dataLayout, bool useNewton3, bool inTuningPhase>
-  void iteratePairwiseTemplateHelper(PairwiseFunctor *f, bool doListRebuild);
+  void iteratePairwiseTemplateHelper(PairwiseFunctor *f, bool doListRebuild, const Configuration &configuration);
+
+  /**
+   * Store configuration and timings of the iteration that just finished.
+   * @param configuration
+   * @param isTuning
+   * @param rebuildTime Time of the neighbor list rebuild in nanoseconds or zero if none took place.
+   * @param traversal Traversal that was run by the container.
+   */
+  void setLastIterationTelemetry(const Configuration &configuration, bool isTuning, long rebuildTime,
+                                 const TraversalInterface &traversal) {
+    _lastIterationTelemetry.configuration = configuration;
+    _lastIterationTelemetry.isTuning = isTuning;
+    _lastIterationTelemetry.rebuildTime = rebuildTime;
+    _lastIterationTelemetry.soaLoadTime = traversal.getInitTraversalTime();
+    _lastIterationTelemetry.traversalTime = traversal.getTraverseParticlePairsTime();
+    _lastIterationTelemetry.soaExtractTime = traversal.getEndTraversalTime();
+  }
+
+  /**
+   * Tuning state of a relevant functor type that uses the container of the leading functor but selects its own
+   * traversal, data layout and newton 3 option.
+   */
+  struct FunctorTuningState {
+    /**
+     * Tuning phase of the leading functor the candidates were derived for. Empty if no candidates were derived yet.
+     */
+    std::optional<size_t> tuningPhase{};
+    /**
+     * Configurations that share the container and neighbor lists with the configuration of the leading functor.
+     */
+    std::vector<Configuration> candidates{};
+    /**
+     * Reduced time of every candidate tested so far, in the order of candidates.
+     */
+    std::vector<size_t> evidence{};
+    /**
+     * Samples of the candidate that is currently tested.
+     */
+    std::vector<size_t> samples{};
+    /**
+     * Configuration the functor currently uses.
+     */
+    Configuration currentConfig{};
+    /**
+     * Whether candidates are still being tested.
+     */
+    bool isTuning{false};
+  };
+
+  /**
+   * Checks whether the given functor drives the tuning strategy.
+   *
+   * Without independent tuning this holds for all relevant functors. Otherwise only the first relevant functor type
+   * that is passed to this function leads.
+   *
+   * @tparam PairwiseFunctor
+   * @param pairwiseFunctor
+   * @return
+   */
+  template <class PairwiseFunctor>
+  bool isLeadingFunctor(PairwiseFunctor &pairwiseFunctor) {
+    if (not pairwiseFunctor.isRelevantForTuning()) {
+      return false;
+    }
+    if (not _tuneFunctorsIndependently) {
+      return true;
+    }
+    if (_leadingFunctor.empty()) {
+      _leadingFunctor = typeid(PairwiseFunctor).name();
+    }
+    return _leadingFunctor == typeid(PairwiseFunctor).name();
+  }
+
+  /**
+   * Checks whether two configurations can use the same container including its neighbor lists.
+   *
+   * Linked cells and direct sum have no neighbor lists, so any traversal, data layout and newton 3 option can be used
+   * on them. The neighbor lists of all other containers depend on the traversal that built them.
+   *
+   * @param lhs
+   * @param rhs
+   * @return
+   */
+  static bool sharesContainer(const Configuration &lhs, const Configuration &rhs) {
+    if (lhs.container != rhs.container or lhs.cellSizeFactor != rhs.cellSizeFactor or
+        lhs.verletSkin != rhs.verletSkin or lhs.verletRebuildFrequency != rhs.verletRebuildFrequency or
+        lhs.verletClusterSize != rhs.verletClusterSize) {
+      return false;
+    }
+    if (lhs.container == ContainerOption::linkedCells or lhs.container == ContainerOption::directSum) {
+      return true;
+    }
+    return lhs.traversal == rhs.traversal and lhs.dataLayout == rhs.dataLayout and lhs.newton3 == rhs.newton3;
+  }
+
+  /**
+   * Select the configuration of a functor that does not drive the tuning strategy.
+   *
+   * While the leading functor tunes, the functor uses the configuration of the leading functor. After every tuning
+   * phase of the leading functor all configurations of the search space that share its container are tested with
+   * this functor and the fastest one is kept until the next tuning phase.
+   *
+   * @tparam PairwiseFunctor
+   * @param pairwiseFunctor
+   * @return true iff the selected configuration should be sampled.
+   */
+  template <class PairwiseFunctor>
+  bool tuneFunctor(PairwiseFunctor &pairwiseFunctor);
+
+  /**
+   * Collect all configurations of the search space that share the container with the current configuration and are
+   * applicable with the given functor.
+   * @tparam PairwiseFunctor
+   * @param pairwiseFunctor
+   * @return Candidates. Contains at least the current configuration.
+   */
+  template <class PairwiseFunctor>
+  std::vector<Configuration> generateFunctorCandidates(PairwiseFunctor &pairwiseFunctor);
 
   /**
    * Tune available algorithm configurations.
@@ -201,130 +504,314 @@ class AutoTuner {
   template <class PairwiseFunctor>
   bool tune(PairwiseFunctor &pairwiseFunctor);
 
+  /**
+   * Run the tuning strategy on a proxy domain until it is finished.
+   *
+   * The proxy domain is a centered box with _proxyDomainFraction of the volume of the domain but at least three
+   * interaction lengths wide. Configurations that are not applicable on the proxy domain are skipped.
+   *
+   * @tparam PairwiseFunctor
+   * @param pairwiseFunctor
+   * @return The _numProxyConfirmations fastest configurations. Empty if the proxy domain holds no particles or no
+   * configuration could be measured. In this case the tuning strategy is reset so the full domain can be tuned.
+   */
+  template <class PairwiseFunctor>
+  std::set<Configuration> tuneOnProxyDomain(PairwiseFunctor &pairwiseFunctor);
+
+  /**
+   * Measure the time of one configuration on a scratch container that holds a copy of the particles in the proxy box.
+   * @tparam PairwiseFunctor
+   * @param pairwiseFunctor
+   * @param configuration
+   * @param proxyBoxMin
+   * @param proxyBoxMax
+   * @return Reduced traversal time plus the amortized rebuild time in nanoseconds. Empty if the traversal is not
+   * applicable on the proxy domain.
+   */
+  template <class PairwiseFunctor>
+  std::optional<double> measureOnProxyDomain(PairwiseFunctor &pairwiseFunctor, const Configuration &configuration,
+                                             const std::array<double, 3> &proxyBoxMin,
+                                             const std::array<double, 3> &proxyBoxMax);
+
+  /**
+   * Try to skip the tuning phase by selecting the optimum stored in the tuning database for the current scenario.
+   * @tparam PairwiseFunctor
+   * @param pairwiseFunctor
+   * @return true iff a stored optimum was found and is applicable.
+   */
+  template <class PairwiseFunctor>
+  bool warmStart(PairwiseFunctor &pairwiseFunctor);
+
+  /**
+   * Describe the current scenario for the tuning database.
+   * @tparam PairwiseFunctor
+   * @return
+   */
+  template <class PairwiseFunctor>
+  ScenarioFingerprint generateScenarioFingerprint();
+
   SelectorStrategyOption _selectorStrategy;
   std::unique_ptr<TuningStrategyInterface> _tuningStrategy;
   unsigned int _tuningInterval, _iterationsSinceTuning;
+  /**
+   * Number of iterations with a relevant functor so far.
+   */
+  size_t _iteration{0};
   ContainerSelector<Particle, ParticleCell> _containerSelector;
-  double _verletSkin;
-  unsigned int _verletClusterSize;
 
   /**
-   * How many times each configuration should be tested.
+   * How many times each configuration should be tested at least.
+   */
+  const size_t _numSamples;
+  /**
+   * How many times each configuration may be tested at most.
    */
   const size_t _maxSamples;
+  /**
+   * Relative half width of the confidence interval below which no further samples are taken.
+   */
+  const double _relativeConfidenceWidth;
   /**
    * How many times this configurations has already been tested.
    * Initialize with max value to start tuning at start of simulation.
    */
   std::vector<size_t> _samples;
+
+  /**
+   * Neighbor list rebuild times measured while sampling the current configuration.
+   */
+  std::vector<size_t> _rebuildSamples;
+
+  /**
+   * Persistent storage of tuning results. nullptr if disabled.
+   */
+  std::unique_ptr<TuningDatabase> _tuningDatabase;
+
+  /**
+   * Scenario description taken at the start of the current tuning phase.
+   */
+  ScenarioFingerprint _scenarioFingerprint;
+
+  /**
+   * Factor by which the first sample of a configuration may exceed the fastest evidence of the current tuning phase
+   * before the configuration is discarded.
+   */
+  double _earlyStoppingFactor;
+
+  /**
+   * Fastest reduced time measurement of the current tuning phase.
+   */
+  double _fastestEvidenceInTuningPhase{std::numeric_limits<double>::infinity()};
+
+  /**
+   * Only the first tuning phase may be replaced by a stored result. Later phases are triggered because the scenario
+   * might have changed.
+   */
+  bool _isFirstTuningPhase{true};
+
+  /**
+   * Detects changes of the iteration time between tuning phases. nullptr if disabled.
+   */
+  std::unique_ptr<DriftMonitor> _driftMonitor;
+
+  /**
+   * Excludes configurations from tuning phases. nullptr if no rules are given.
+   */
+  std::unique_ptr<RuleBasedPruning> _pruning;
+
+  /**
+   * Writes all measurements of tuning phases to a file. nullptr if disabled.
+   */
+  std::unique_ptr<TuningRecorder> _tuningRecorder;
+
+  /**
+   * Whether functor types other than the leading one select their own traversal, data layout and newton 3 option.
+   */
+  bool _tuneFunctorsIndependently;
+
+  /**
+   * Type name of the functor that drives the tuning strategy. Empty until the first relevant functor is seen.
+   */
+  std::string _leadingFunctor;
+
+  /**
+   * Number of tuning phases the leading functor completed.
+   */
+  size_t _numTuningPhases{0};
+
+  /**
+   * Tuning states of all relevant functor types except the leading one, identified by their type name.
+   */
+  std::map<std::string, FunctorTuningState> _functorTuningStates;
+
+  /**
+   * Fraction of the domain volume used for proxy tuning. Values of one or above disable proxy tuning.
+   */
+  double _proxyDomainFraction;
+
+  /**
+   * Number of configurations of the proxy domain that are sampled on the full domain.
+   */
+  unsigned int _numProxyConfirmations;
+
+  /**
+   * Tuning strategy spanning the whole search space while _tuningStrategy only confirms the results of the proxy
+   * domain. nullptr otherwise.
+   */
+  std::unique_ptr<TuningStrategyInterface> _proxiedTuningStrategy;
+
+  /**
+   * Hardware performance counters read during tuning. nullptr if disabled or unavailable.
+   */
+  std::unique_ptr<utils::PerformanceCounters> _performanceCounters;
+
+  /**
+   * Sum of the performance counters of all samples of the current configuration.
+   */
+  utils::PerformanceCounterValues _performanceCounterSamples;
+
+  /**
+   * Performance counters of the last measurement of every configuration.
+   */
+  std::map<Configuration, utils::PerformanceCounterValues> _performanceCounterEvidence;
+
+  /**
+   * Configuration and timings of the last call to iteratePairwise().
+   */
+  IterationTelemetry _lastIterationTelemetry;
 };
 
 template <class Particle, class ParticleCell>
 void AutoTuner<Particle, ParticleCell>::selectCurrentContainer() {
   auto conf = _tuningStrategy->getCurrentConfiguration();
-  _containerSelector.selectContainer(conf.container,
-                                     ContainerSelectorInfo(conf.cellSizeFactor, _verletSkin, _verletClusterSize));
+  _containerSelector.selectContainer(
+      conf.container, ContainerSelectorInfo(conf.cellSizeFactor, conf.verletSkin, conf.verletClusterSize));
 }
 
 template <class Particle, class ParticleCell>
 template <class PairwiseFunctor>
 bool AutoTuner<Particle, ParticleCell>::iteratePairwise(PairwiseFunctor *f, bool doListRebuild) {
   bool isTuning = false;
+  const bool isLeading = isLeadingFunctor(*f);
   // tune if :
   // - more than one config exists
   // - currently in tuning phase
-  // - functor is relevant
-  if ((not _tuningStrategy->searchSpaceIsTrivial()) and _iterationsSinceTuning >= _tuningInterval and
-      f->isRelevantForTuning()) {
+  // - functor drives the tuning strategy
+  if ((not _tuningStrategy->searchSpaceIsTrivial()) and _iterationsSinceTuning >= _tuningInterval and isLeading) {
     isTuning = tune<PairwiseFunctor>(*f);
     if (not isTuning) {
       _iterationsSinceTuning = 0;
+      ++_numTuningPhases;
+      if (_driftMonitor) {
+        _driftMonitor->reset();
+      }
     }
   }
 
+  // other relevant functors use their own configuration on the container of the leading functor
+  const bool hasOwnConfiguration = _tuneFunctorsIndependently and f->isRelevantForTuning() and not isLeading;
+  if (hasOwnConfiguration) {
+    isTuning = tuneFunctor(*f);
+  }
+  const Configuration configuration = hasOwnConfiguration
+                                          ? _functorTuningStates[typeid(PairwiseFunctor).name()].currentConfig
+                                          : _tuningStrategy->getCurrentConfiguration();
+
   // large case differentiation for data layout and newton 3
-  switch (_tuningStrategy->getCurrentConfiguration().dataLayout) {
+  switch (configuration.dataLayout) {
     case DataLayoutOption::aos: {
-      if (_tuningStrategy->getCurrentConfiguration().newton3 == Newton3Option::enabled) {
+      if (configuration.newton3 == Newton3Option::enabled) {
         if (isTuning) {
           iteratePairwiseTemplateHelper<PairwiseFunctor, DataLayoutOption::aos, /*Newton3*/ true,
-                                        /*tuning*/ true>(f, doListRebuild);
+                                        /*tuning*/ true>(f, doListRebuild, configuration);
         } else {
           iteratePairwiseTemplateHelper<PairwiseFunctor, DataLayoutOption::aos, /*Newton3*/ true,
-                                        /*tuning*/ false>(f, doListRebuild);
+                                        /*tuning*/ false>(f, doListRebuild, configuration);
         }
       } else {
         if (isTuning) {
           iteratePairwiseTemplateHelper<PairwiseFunctor, DataLayoutOption::aos, /*Newton3*/ false,
-                                        /*tuning*/ true>(f, doListRebuild);
+                                        /*tuning*/ true>(f, doListRebuild, configuration);
         } else {
           iteratePairwiseTemplateHelper<PairwiseFunctor, DataLayoutOption::aos, /*Newton3*/ false,
-                                        /*tuning*/ false>(f, doListRebuild);
+                                        /*tuning*/ false>(f, doListRebuild, configuration);
         }
       }
       break;
     }
     case DataLayoutOption::soa: {
-      if (_tuningStrategy->getCurrentConfiguration().newton3 == Newton3Option::enabled) {
+      if (configuration.newton3 == Newton3Option::enabled) {
         if (isTuning) {
           iteratePairwiseTemplateHelper<PairwiseFunctor, DataLayoutOption::soa, /*Newton3*/ true,
-                                        /*tuning*/ true>(f, doListRebuild);
+                                        /*tuning*/ true>(f, doListRebuild, configuration);
         } else {
           iteratePairwiseTemplateHelper<PairwiseFunctor, DataLayoutOption::soa, /*Newton3*/ true,
-                                        /*tuning*/ false>(f, doListRebuild);
+                                        /*tuning*/ false>(f, doListRebuild, configuration);
         }
       } else {
         if (isTuning) {
           iteratePairwiseTemplateHelper<PairwiseFunctor, DataLayoutOption::soa, /*Newton3*/ false,
-                                        /*tuning*/ true>(f, doListRebuild);
+                                        /*tuning*/ true>(f, doListRebuild, configuration);
         } else {
           iteratePairwiseTemplateHelper<PairwiseFunctor, DataLayoutOption::soa, /*Newton3*/ false,
-                                        /*tuning*/ false>(f, doListRebuild);
+                                        /*tuning*/ false>(f, doListRebuild, configuration);
         }
       }
       break;
     }
 #if defined(AUTOPAS_CUDA)
     case DataLayoutOption::cuda: {
-      if (_tuningStrategy->getCurrentConfiguration().newton3 == Newton3Option::enabled) {
+      if (configuration.newton3 == Newton3Option::enabled) {
         if (isTuning) {
           iteratePairwiseTemplateHelper<PairwiseFunctor, DataLayoutOption::cuda, /*Newton3*/ true,
-                                        /*tuning*/ true>(f, doListRebuild);
+                                        /*tuning*/ true>(f, doListRebuild, configuration);
         } else {
           iteratePairwiseTemplateHelper<PairwiseFunctor, DataLayoutOption::cuda, /*Newton3*/ true,
-                                        /*tuning*/ false>(f, doListRebuild);
+                                        /*tuning*/ false>(f, doListRebuild, configuration);
         }
       } else {
         if (isTuning) {
           iteratePairwiseTemplateHelper<PairwiseFunctor, DataLayoutOption::cuda, /*Newton3*/ false,
-                                        /*tuning*/ true>(f, doListRebuild);
+                                        /*tuning*/ true>(f, doListRebuild, configuration);
         } else {
           iteratePairwiseTemplateHelper<PairwiseFunctor, DataLayoutOption::cuda, /*Newton3*/ false,
-                                        /*tuning*/ false>(f, doListRebuild);
+                                        /*tuning*/ false>(f, doListRebuild, configuration);
         }
       }
       break;
     }
 #endif
     default:
-      utils::ExceptionHandler::exception("AutoTuner: Unknown data layout : {}",
-                                         _tuningStrategy->getCurrentConfiguration().dataLayout);
+      utils::ExceptionHandler::exception("AutoTuner: Unknown data layout : {}", configuration.dataLayout);
   }
 
-  if (f->isRelevantForTuning()) {
+  if (isLeading) {
+    ++_iteration;
     ++_iterationsSinceTuning;
+    // start the next tuning phase early if the performance of the selected configuration changed
+    if (_driftMonitor and not isTuning and _iterationsSinceTuning < _tuningInterval and
+        _driftMonitor->driftDetected()) {
+      AutoPasLog(debug, "Iteration time drifted from {} to {} nanoseconds. Starting new tuning phase.",
+                 _driftMonitor->getBaselineMean(), _driftMonitor->getRecentMean());
+      _iterationsSinceTuning = _tuningInterval;
+    }
   }
   return isTuning;
 }
 
 template <class Particle, class ParticleCell>
 template <class PairwiseFunctor, DataLayoutOption::Value dataLayout, bool useNewton3, bool inTuningPhase>
-void AutoTuner<Particle, ParticleCell>::iteratePairwiseTemplateHelper(PairwiseFunctor *f, bool doListRebuild) {
+void AutoTuner<Particle, ParticleCell>::iteratePairwiseTemplateHelper(PairwiseFunctor *f, bool doListRebuild,
+                                                                     const Configuration &configuration) {
   auto containerPtr = getContainer();
-  AutoPasLog(debug, "Iterating with configuration: {}", _tuningStrategy->getCurrentConfiguration().toString());
+  AutoPasLog(debug, "Iterating with configuration: {}", configuration.toString());
+
+  // the traversal has to be generated with these settings too since e.g. the sliced traversal adapts to the threads
+  utils::ScopedOpenMPSettings openMPSettings(configuration.numThreads, configuration.schedule,
+                                             configuration.scheduleChunkSize);
 
   auto traversal = TraversalSelector<ParticleCell>::template generateTraversal<PairwiseFunctor, dataLayout, useNewton3>(
-      _tuningStrategy->getCurrentConfiguration().traversal, *f, containerPtr->getTraversalSelectorInfo());
+      configuration.traversal, *f, containerPtr->getTraversalSelectorInfo());
 
   if (not traversal->isApplicable()) {
     autopas::utils::ExceptionHandler::exception(
@@ -334,31 +821,57 @@ void AutoTuner<Particle, ParticleCell>::iteratePairwiseTemplateHelper(PairwiseFu
         "the first.\n"
         "Config: {}\n"
         "Current functor: {}",
-        _tuningStrategy->getCurrentConfiguration().toString(), typeid(*f).name());
+        configuration.toString(), typeid(*f).name());
   }
 
   // if tuning execute with time measurements
   if (inTuningPhase) {
-    autopas::utils::Timer timer;
-    timer.start();
+    autopas::utils::Timer timerRebuild, timerIteratePairwise;
+    // the counters cover the rebuild and the traversal of samples that become evidence
+    const bool countEvents = _performanceCounters and isLeadingFunctor(*f) and needsMoreSamples();
+    if (countEvents) {
+      _performanceCounters->start();
+    }
 
     f->initTraversal();
+    long rebuildTime = 0;
     if (doListRebuild) {
+      timerRebuild.start();
       containerPtr->rebuildNeighborLists(traversal.get());
+      rebuildTime = timerRebuild.stop();
+      AutoPasLog(debug, "RebuildNeighborLists took {} nanoseconds", rebuildTime);
+      addRebuildTimeMeasurement(*f, rebuildTime);
     }
+    timerIteratePairwise.start();
     containerPtr->iteratePairwise(traversal.get());
     f->endTraversal(useNewton3);
 
-    auto runtime = timer.stop();
+    auto runtime = timerIteratePairwise.stop();
+    if (countEvents) {
+      _performanceCounterSamples += _performanceCounters->stop();
+    }
     AutoPasLog(debug, "IteratePairwise took {} nanoseconds", runtime);
     addTimeMeasurement(*f, runtime);
+    setLastIterationTelemetry(configuration, inTuningPhase, rebuildTime, *traversal);
   } else {
     f->initTraversal();
+    long rebuildTime = 0;
     if (doListRebuild) {
+      autopas::utils::Timer timerRebuild;
+      timerRebuild.start();
       containerPtr->rebuildNeighborLists(traversal.get());
+      rebuildTime = timerRebuild.stop();
+    }
+    if (_driftMonitor and isLeadingFunctor(*f)) {
+      autopas::utils::Timer timerIteratePairwise;
+      timerIteratePairwise.start();
+      containerPtr->iteratePairwise(traversal.get());
+      _driftMonitor->addMeasurement(timerIteratePairwise.stop());
+    } else {
+      containerPtr->iteratePairwise(traversal.get());
     }
-    containerPtr->iteratePairwise(traversal.get());
     f->endTraversal(useNewton3);
+    setLastIterationTelemetry(configuration, inTuningPhase, rebuildTime, *traversal);
   }
 }
 
@@ -368,13 +881,36 @@ bool AutoTuner<Particle, ParticleCell>::tune(PairwiseFunctor &pairwiseFunctor) {
   bool stillTuning = true;
 
   // need more samples; keep current config
-  if (_samples.size() < _maxSamples) {
+  if (needsMoreSamples()) {
     return stillTuning;
   }
 
   // first tuning iteration -> reset to first config
   if (_iterationsSinceTuning == _tuningInterval) {
+    if (_tuningDatabase) {
+      _scenarioFingerprint = generateScenarioFingerprint<PairwiseFunctor>();
+      if (std::exchange(_isFirstTuningPhase, false) and warmStart(pairwiseFunctor)) {
+        return false;
+      }
+    }
+    _fastestEvidenceInTuningPhase = std::numeric_limits<double>::infinity();
+    const auto statistics = DomainStatistics::collect(*getContainer(), autopas_get_max_threads());
+    if (_pruning) {
+      _pruning->setStatistics(statistics);
+    }
+    _tuningStrategy->setDomainStatistics(statistics);
     _tuningStrategy->reset();
+    if (_proxyDomainFraction < 1.) {
+      auto proxyCandidates = tuneOnProxyDomain(pairwiseFunctor);
+      if (proxyCandidates.size() == 1) {
+        // nothing left to compare on the full domain
+        _tuningStrategy->setCurrentConfiguration(*proxyCandidates.begin());
+        stillTuning = false;
+      } else if (not proxyCandidates.empty()) {
+        _proxiedTuningStrategy =
+            std::exchange(_tuningStrategy, std::make_unique<FullSearch>(std::move(proxyCandidates)));
+      }
+    }
   } else {  // enough samples -> next config
     stillTuning = _tuningStrategy->tune();
   }
@@ -390,6 +926,11 @@ bool AutoTuner<Particle, ParticleCell>::tune(PairwiseFunctor &pairwiseFunctor) {
                  _tuningStrategy->getCurrentConfiguration().newton3.to_string());
 
       _tuningStrategy->removeN3Option(_tuningStrategy->getCurrentConfiguration().newton3);
+    } else if (const auto *rule = _pruning ? _pruning->findPruningRule(_tuningStrategy->getCurrentConfiguration())
+                                           : nullptr) {
+      AutoPasLog(debug, "Skip pruned configuration {} ({})", _tuningStrategy->getCurrentConfiguration().toString(),
+                 rule->description);
+      stillTuning = _tuningStrategy->tune(true);
     } else {
       if (configApplicable(_tuningStrategy->getCurrentConfiguration(), pairwiseFunctor)) {
         // we found a valid config!
@@ -401,16 +942,254 @@ bool AutoTuner<Particle, ParticleCell>::tune(PairwiseFunctor &pairwiseFunctor) {
       }
     }
   }
-  // samples should only be cleared if we are still tuning, see `if (_samples.size() < _maxSamples)` from before.
+  // samples should only be cleared if we are still tuning, see `if (needsMoreSamples())` from before.
   if (stillTuning) {
     // samples are no longer needed. Delete them here so willRebuild() works as expected.
     _samples.clear();
+    _rebuildSamples.clear();
+    _performanceCounterSamples = {};
+  } else {
+    if (_proxiedTuningStrategy) {
+      // hand the confirmed optimum back to the strategy that spans the whole search space
+      const auto optimum = _tuningStrategy->getCurrentConfiguration();
+      _tuningStrategy = std::move(_proxiedTuningStrategy);
+      _tuningStrategy->setCurrentConfiguration(optimum);
+    }
+    if (_tuningDatabase) {
+      _tuningDatabase->store(_scenarioFingerprint, _tuningStrategy->getCurrentConfiguration());
+    }
   }
 
   selectCurrentContainer();
   return stillTuning;
 }
 
+template <class Particle, class ParticleCell>
+template <class PairwiseFunctor>
+bool AutoTuner<Particle, ParticleCell>::tuneFunctor(PairwiseFunctor &pairwiseFunctor) {
+  auto &state = _functorTuningStates[typeid(PairwiseFunctor).name()];
+
+  // the container might change with every step while the leading functor tunes
+  if ((not _tuningStrategy->searchSpaceIsTrivial()) and _iterationsSinceTuning >= _tuningInterval) {
+    state.currentConfig = _tuningStrategy->getCurrentConfiguration();
+    state.isTuning = false;
+    return false;
+  }
+
+  // the leading functor selected a new optimum -> test all candidates for it
+  if (state.tuningPhase != _numTuningPhases) {
+    state.tuningPhase = _numTuningPhases;
+    state.candidates = generateFunctorCandidates(pairwiseFunctor);
+    state.evidence.clear();
+    state.samples.clear();
+    state.currentConfig = state.candidates.front();
+    state.isTuning = state.candidates.size() > 1;
+  }
+
+  // enough samples -> next candidate or optimum
+  if (state.isTuning and state.samples.size() >= _numSamples) {
+    state.evidence.push_back(OptimumSelector::optimumValue(state.samples, _selectorStrategy));
+    state.samples.clear();
+    if (state.evidence.size() < state.candidates.size()) {
+      state.currentConfig = state.candidates[state.evidence.size()];
+    } else {
+      const auto fastest = std::min_element(state.evidence.begin(), state.evidence.end()) - state.evidence.begin();
+      state.currentConfig = state.candidates[fastest];
+      state.isTuning = false;
+      AutoPasLog(debug, "Selected configuration {} for functor {}", state.currentConfig.toString(),
+                 typeid(PairwiseFunctor).name());
+    }
+  }
+  return state.isTuning;
+}
+
+template <class Particle, class ParticleCell>
+template <class PairwiseFunctor>
+std::vector<Configuration> AutoTuner<Particle, ParticleCell>::generateFunctorCandidates(
+    PairwiseFunctor &pairwiseFunctor) {
+  const auto &leadingConfig = _tuningStrategy->getCurrentConfiguration();
+  std::vector<Configuration> candidates;
+  for (const auto &traversal : compatibleTraversals::allCompatibleTraversals(leadingConfig.container)) {
+    for (const auto &dataLayout : DataLayoutOption::getAllOptions()) {
+      for (const auto &newton3 : Newton3Option::getAllOptions()) {
+        auto candidate = leadingConfig;
+        candidate.traversal = traversal;
+        candidate.dataLayout = dataLayout;
+        candidate.newton3 = newton3;
+        if (not sharesContainer(leadingConfig, candidate) or not _tuningStrategy->searchSpaceContains(candidate) or
+            (newton3 == Newton3Option::enabled and not pairwiseFunctor.allowsNewton3()) or
+            (newton3 == Newton3Option::disabled and not pairwiseFunctor.allowsNonNewton3()) or
+            (_pruning and _pruning->findPruningRule(candidate)) or not configApplicable(candidate, pairwiseFunctor)) {
+          continue;
+        }
+        candidates.push_back(candidate);
+      }
+    }
+  }
+  // fall back to the configuration of the leading functor
+  if (candidates.empty()) {
+    candidates.push_back(leadingConfig);
+  }
+  return candidates;
+}
+
+template <class Particle, class ParticleCell>
+template <class PairwiseFunctor>
+std::set<Configuration> AutoTuner<Particle, ParticleCell>::tuneOnProxyDomain(PairwiseFunctor &pairwiseFunctor) {
+  auto container = getContainer();
+  const auto &boxMin = container->getBoxMin();
+  const auto &boxMax = container->getBoxMax();
+  const double scale = std::cbrt(_proxyDomainFraction);
+  std::array<double, 3> proxyBoxMin{}, proxyBoxMax{};
+  for (size_t d = 0; d < 3; ++d) {
+    const double length = boxMax[d] - boxMin[d];
+    const double proxyLength = std::min(length, std::max(scale * length, 3. * container->getInteractionLength()));
+    proxyBoxMin[d] = boxMin[d] + (length - proxyLength) / 2.;
+    proxyBoxMax[d] = proxyBoxMin[d] + proxyLength;
+  }
+
+  size_t numParticles = 0, numProxyParticles = 0;
+  for (auto iter = container->begin(IteratorBehavior::ownedOnly); iter.isValid(); ++iter) {
+    ++numParticles;
+    if (utils::inBox(iter->getR(), proxyBoxMin, proxyBoxMax)) {
+      ++numProxyParticles;
+    }
+  }
+  if (numProxyParticles == 0) {
+    AutoPasLog(debug, "Proxy domain holds no particles. Tuning on the full domain.");
+    return {};
+  }
+
+  // same loop as in tune() but every configuration is measured right away
+  std::vector<std::pair<size_t, Configuration>> proxyEvidence;
+  bool stillTuning = true;
+  while (stillTuning) {
+    const auto configuration = _tuningStrategy->getCurrentConfiguration();
+    if ((configuration.newton3 == Newton3Option::enabled and not pairwiseFunctor.allowsNewton3()) or
+        (configuration.newton3 == Newton3Option::disabled and not pairwiseFunctor.allowsNonNewton3())) {
+      _tuningStrategy->removeN3Option(configuration.newton3);
+      continue;
+    }
+    if ((_pruning and _pruning->findPruningRule(configuration)) or
+        not configApplicable(configuration, pairwiseFunctor)) {
+      stillTuning = _tuningStrategy->tune(true);
+      continue;
+    }
+    const auto proxyTime = measureOnProxyDomain(pairwiseFunctor, configuration, proxyBoxMin, proxyBoxMax);
+    if (not proxyTime) {
+      AutoPasLog(debug, "Skip configuration {} not applicable on the proxy domain", configuration.toString());
+      stillTuning = _tuningStrategy->tune(true);
+      continue;
+    }
+    // scale the time per particle to the full domain so the strategy sees comparable values
+    const auto value = static_cast<size_t>(*proxyTime * static_cast<double>(numParticles) / numProxyParticles);
+    AutoPasLog(debug, "Proxy domain estimate for {} : {}", configuration.toString(), value);
+    proxyEvidence.emplace_back(value, configuration);
+    _tuningStrategy->addEvidence(value);
+    stillTuning = _tuningStrategy->tune();
+  }
+
+  if (proxyEvidence.empty()) {
+    AutoPasLog(debug, "No configuration could be measured on the proxy domain. Tuning on the full domain.");
+    _tuningStrategy->reset();
+    return {};
+  }
+
+  // strategies may suggest a configuration more than once
+  std::sort(proxyEvidence.begin(), proxyEvidence.end());
+  std::set<Configuration> candidates;
+  for (const auto &[value, configuration] : proxyEvidence) {
+    if (candidates.size() >= _numProxyConfirmations) {
+      break;
+    }
+    candidates.insert(configuration);
+  }
+  return candidates;
+}
+
+template <class Particle, class ParticleCell>
+template <class PairwiseFunctor>
+std::optional<double> AutoTuner<Particle, ParticleCell>::measureOnProxyDomain(
+    PairwiseFunctor &pairwiseFunctor, const Configuration &configuration, const std::array<double, 3> &proxyBoxMin,
+    const std::array<double, 3> &proxyBoxMax) {
+  // a fresh container for every configuration, so no particles have to be converted between containers
+  ContainerSelector<Particle, ParticleCell> proxySelector(proxyBoxMin, proxyBoxMax, getContainer()->getCutoff());
+  proxySelector.selectContainer(
+      configuration.container,
+      ContainerSelectorInfo(configuration.cellSizeFactor, configuration.verletSkin, configuration.verletClusterSize));
+  auto proxyContainer = proxySelector.getCurrentContainer();
+
+  // particles of the full domain around the proxy box become its halo
+  const auto haloBoxMin = utils::ArrayMath::subScalar(proxyBoxMin, proxyContainer->getInteractionLength());
+  const auto haloBoxMax = utils::ArrayMath::addScalar(proxyBoxMax, proxyContainer->getInteractionLength());
+  for (auto iter = getContainer()->getRegionIterator(haloBoxMin, haloBoxMax, IteratorBehavior::haloAndOwned);
+       iter.isValid(); ++iter) {
+    if (utils::inBox(iter->getR(), proxyBoxMin, proxyBoxMax)) {
+      proxyContainer->addParticle(*iter);
+    } else {
+      proxyContainer->addHaloParticle(*iter);
+    }
+  }
+
+  utils::ScopedOpenMPSettings openMPSettings(configuration.numThreads, configuration.schedule,
+                                             configuration.scheduleChunkSize);
+  auto traversal = TraversalSelector<ParticleCell>::template generateTraversal<PairwiseFunctor>(
+      configuration.traversal, pairwiseFunctor, proxyContainer->getTraversalSelectorInfo(), configuration.dataLayout,
+      configuration.newton3);
+  if (not traversal->isApplicable()) {
+    return std::nullopt;
+  }
+
+  // the neighbor lists are built once and amortized over the rebuild frequency like on the full domain
+  autopas::utils::Timer timer;
+  std::vector<size_t> samples;
+  long rebuildTime = 0;
+  for (size_t sample = 0; sample < _numSamples; ++sample) {
+    pairwiseFunctor.initTraversal();
+    if (sample == 0) {
+      timer.start();
+      proxyContainer->rebuildNeighborLists(traversal.get());
+      rebuildTime = timer.stop();
+    }
+    timer.start();
+    proxyContainer->iteratePairwise(traversal.get());
+    pairwiseFunctor.endTraversal(configuration.newton3 == Newton3Option::enabled);
+    samples.push_back(timer.stop());
+  }
+  return static_cast<double>(OptimumSelector::optimumValue(samples, _selectorStrategy)) +
+         static_cast<double>(rebuildTime) / configuration.verletRebuildFrequency;
+}
+
+template <class Particle, class ParticleCell>
+template <class PairwiseFunctor>
+bool AutoTuner<Particle, ParticleCell>::warmStart(PairwiseFunctor &pairwiseFunctor) {
+  auto storedOptimum = _tuningDatabase->lookup(_scenarioFingerprint);
+  if (not storedOptimum) {
+    AutoPasLog(debug, "No stored optimum for scenario {}", _scenarioFingerprint.toString());
+    return false;
+  }
+
+  if ((storedOptimum->newton3 == Newton3Option::enabled and not pairwiseFunctor.allowsNewton3()) or
+      (storedOptimum->newton3 == Newton3Option::disabled and not pairwiseFunctor.allowsNonNewton3()) or
+      not _tuningStrategy->setCurrentConfiguration(*storedOptimum) or
+      not configApplicable(*storedOptimum, pairwiseFunctor)) {
+    AutoPasLog(debug, "Stored optimum {} is not valid for the current search space.", storedOptimum->toString());
+    return false;
+  }
+
+  AutoPasLog(debug, "Skipping tuning phase. Using stored optimum {}", storedOptimum->toString());
+  selectCurrentContainer();
+  return true;
+}
+
+template <class Particle, class ParticleCell>
+template <class PairwiseFunctor>
+ScenarioFingerprint AutoTuner<Particle, ParticleCell>::generateScenarioFingerprint() {
+  auto container = getContainer();
+  return ScenarioFingerprint(container->getBoxMin(), container->getBoxMax(), container->getCutoff(),
+                             container->getNumParticles(), autopas_get_max_threads(), typeid(PairwiseFunctor).name());
+}
+
 template <class Particle, class ParticleCell>
 template <class PairwiseFunctor>
 bool AutoTuner<Particle, ParticleCell>::configApplicable(const Configuration &conf, PairwiseFunctor &pairwiseFunctor) {
@@ -420,9 +1199,15 @@ bool AutoTuner<Particle, ParticleCell>::configApplicable(const Configuration &co
     return false;
   }
 
-  _containerSelector.selectContainer(conf.container,
-                                     ContainerSelectorInfo(conf.cellSizeFactor, _verletSkin, _verletClusterSize));
-  auto traversalInfo = _containerSelector.getCurrentContainer()->getTraversalSelectorInfo();
+  if (conf.numThreads > static_cast<unsigned int>(autopas_get_max_threads())) {
+    // more threads than available. Thread buffers of e.g. the functors are not large enough for this.
+    return false;
+  }
+  utils::ScopedOpenMPSettings openMPSettings(conf.numThreads, conf.schedule, conf.scheduleChunkSize);
+
+  // only derive the traversal info so no container has to be built and filled with particles
+  auto traversalInfo = _containerSelector.getTraversalSelectorInfo(
+      conf.container, ContainerSelectorInfo(conf.cellSizeFactor, conf.verletSkin, conf.verletClusterSize));
 
   return TraversalSelector<ParticleCell>::template generateTraversal<PairwiseFunctor>(
              conf.traversal, pairwiseFunctor, traversalInfo, conf.dataLayout, conf.newton3)
@@ -433,4 +1218,15 @@ template <class Particle, class ParticleCell>
 autopas::Configuration AutoTuner<Particle, ParticleCell>::getCurrentConfig() const {
   return _tuningStrategy->getCurrentConfiguration();
 }
+
+template <class Particle, class ParticleCell>
+template <class PairwiseFunctor>
+autopas::Configuration AutoTuner<Particle, ParticleCell>::getFunctorConfig() const {
+  const std::string functorName = typeid(PairwiseFunctor).name();
+  auto state = _functorTuningStates.find(functorName);
+  if (functorName == _leadingFunctor or state == _functorTuningStates.end()) {
+    return _tuningStrategy->getCurrentConfiguration();
+  }
+  return state->second.currentConfig;
+}
 }  // namespace autopas
@@ -11,6 +11,7 @@
 #include "autopas/options/ContainerOption.h"
 #include "autopas/options/DataLayoutOption.h"
 #include "autopas/options/Newton3Option.h"
+#include "autopas/options/ScheduleOption.h"
 #include "autopas/options/TraversalOption.h"
 #include "autopas/utils/StringUtils.h"
 
@@ -28,19 +29,45 @@ class Configuration {
    * @param _dataLayout
    * @param _newton3
    * @param _cellSizeFactor
+   * @param _verletSkin The default of no skin is only valid together with a rebuild in every iteration.
+   * @param _verletRebuildFrequency
+   * @param _numThreads The default of zero uses all available threads.
+   * @param _schedule
+   * @param _scheduleChunkSize
+   * @param _verletClusterSize Only relevant for the cluster containers.
    */
   Configuration(ContainerOption _container, double _cellSizeFactor, TraversalOption _traversal,
-                DataLayoutOption _dataLayout, Newton3Option _newton3)
+                DataLayoutOption _dataLayout, Newton3Option _newton3, double _verletSkin = 0.,
+                unsigned int _verletRebuildFrequency = 1, unsigned int _numThreads = 0,
+                ScheduleOption _schedule = ScheduleOption::dynamicSchedule, unsigned int _scheduleChunkSize = 1,
+                unsigned int _verletClusterSize = 4)
       : container(_container),
         traversal(_traversal),
         dataLayout(_dataLayout),
         newton3(_newton3),
-        cellSizeFactor(_cellSizeFactor) {}
+        cellSizeFactor(_cellSizeFactor),
+        verletSkin(_verletSkin),
+        verletRebuildFrequency(_verletRebuildFrequency),
+        numThreads(_numThreads),
+        schedule(_schedule),
+        scheduleChunkSize(_scheduleChunkSize),
+        verletClusterSize(_verletClusterSize) {}
 
   /**
    * Constructor taking no arguments. Initializes all properties to an invalid choice or false.
    */
-  Configuration() : container(), traversal(), dataLayout(), newton3(), cellSizeFactor(-1.) {}
+  Configuration()
+      : container(),
+        traversal(),
+        dataLayout(),
+        newton3(),
+        cellSizeFactor(-1.),
+        verletSkin(-1.),
+        verletRebuildFrequency(0),
+        numThreads(0),
+        schedule(),
+        scheduleChunkSize(0),
+        verletClusterSize(0) {}
 
   /**
    * Returns string representation in JSON style of the configuration object.
@@ -49,7 +76,11 @@ class Configuration {
   std::string toString() const {
     return "{Container: " + container.to_string() + " , CellSizeFactor: " + std::to_string(cellSizeFactor) +
            " , Traversal: " + traversal.to_string() + " , Data Layout: " + dataLayout.to_string() +
-           " , Newton 3: " + newton3.to_string() + "}";
+           " , Newton 3: " + newton3.to_string() + " , Verlet Skin: " + std::to_string(verletSkin) +
+           " , Rebuild Frequency: " + std::to_string(verletRebuildFrequency) +
+           " , Threads: " + std::to_string(numThreads) + " , Schedule: " + schedule.to_string() +
+           " , Chunk Size: " + std::to_string(scheduleChunkSize) +
+           " , Cluster Size: " + std::to_string(verletClusterSize) + "}";
   }
 
   /**
@@ -72,6 +103,30 @@ class Configuration {
    * CellSizeFactor
    */
   double cellSizeFactor;
+  /**
+   * Length added to the cutoff for the Verlet lists' skin.
+   */
+  double verletSkin;
+  /**
+   * Number of iterations between two rebuilds of the container and its neighbor lists.
+   */
+  unsigned int verletRebuildFrequency;
+  /**
+   * Number of OpenMP threads the traversal may use. Zero means all available threads.
+   */
+  unsigned int numThreads;
+  /**
+   * OpenMP schedule kind for the loops of the traversal.
+   */
+  ScheduleOption schedule;
+  /**
+   * OpenMP chunk size for the loops of the traversal. Zero means the default of the schedule kind.
+   */
+  unsigned int scheduleChunkSize;
+  /**
+   * Number of particles per cluster of the Verlet cluster containers.
+   */
+  unsigned int verletClusterSize;
 };
 
 /**
@@ -95,7 +150,10 @@ inline std::ostream &operator<<(std::ostream &os, const Configuration &configura
  */
 inline bool operator==(const Configuration &lhs, const Configuration &rhs) {
   return lhs.container == rhs.container and lhs.cellSizeFactor == rhs.cellSizeFactor and
-         lhs.traversal == rhs.traversal and lhs.dataLayout == rhs.dataLayout and lhs.newton3 == rhs.newton3;
+         lhs.traversal == rhs.traversal and lhs.dataLayout == rhs.dataLayout and lhs.newton3 == rhs.newton3 and
+         lhs.verletSkin == rhs.verletSkin and lhs.verletRebuildFrequency == rhs.verletRebuildFrequency and
+         lhs.numThreads == rhs.numThreads and lhs.schedule == rhs.schedule and
+         lhs.scheduleChunkSize == rhs.scheduleChunkSize and lhs.verletClusterSize == rhs.verletClusterSize;
 }
 
 /**
@@ -113,15 +171,20 @@ inline bool operator!=(const Configuration &lhs, const Configuration &rhs) { ret
  * Comparison operator for Configuration objects. This is mainly used for configurations to have a sane ordering in e.g.
  * sets.
  *
- * Configurations are compared member wise in the order: container, cellSizeFactor, traversal, dataLayout, newton3.
+ * Configurations are compared member wise in the order: container, cellSizeFactor, traversal, dataLayout, newton3,
+ * verletSkin, verletRebuildFrequency, numThreads, schedule, scheduleChunkSize, verletClusterSize.
  *
  * @param lhs
  * @param rhs
  * @return
  */
 inline bool operator<(const Configuration &lhs, const Configuration &rhs) {
-  return std::tie(lhs.container, lhs.cellSizeFactor, lhs.traversal, lhs.dataLayout, lhs.newton3) <
-         std::tie(rhs.container, rhs.cellSizeFactor, rhs.traversal, rhs.dataLayout, rhs.newton3);
+  return std::tie(lhs.container, lhs.cellSizeFactor, lhs.traversal, lhs.dataLayout, lhs.newton3, lhs.verletSkin,
+                  lhs.verletRebuildFrequency, lhs.numThreads, lhs.schedule, lhs.scheduleChunkSize,
+                  lhs.verletClusterSize) <
+         std::tie(rhs.container, rhs.cellSizeFactor, rhs.traversal, rhs.dataLayout, rhs.newton3, rhs.verletSkin,
+                  rhs.verletRebuildFrequency, rhs.numThreads, rhs.schedule, rhs.scheduleChunkSize,
+                  rhs.verletClusterSize);
 }
 
 /**
@@ -138,9 +201,15 @@ struct ConfigHash {
                            static_cast<std::size_t>(configuration.dataLayout) * 10 +
                            static_cast<std::size_t>(configuration.traversal) * 100 +
                            static_cast<std::size_t>(configuration.container) * 10000;
-    std::size_t doubleHash = std::hash<double>{}(configuration.cellSizeFactor);
+    std::size_t doubleHash = std::hash<double>{}(configuration.cellSizeFactor) ^
+                             (std::hash<double>{}(configuration.verletSkin) << 1u);
+
+    std::size_t openMPHash = (static_cast<std::size_t>(configuration.numThreads) << 30u) ^
+                             (static_cast<std::size_t>(configuration.schedule) << 40u) ^
+                             (static_cast<std::size_t>(configuration.scheduleChunkSize) << 44u);
 
-    return enumHash ^ doubleHash;
+    return enumHash ^ doubleHash ^ (static_cast<std::size_t>(configuration.verletRebuildFrequency) << 20u) ^
+           openMPHash ^ (static_cast<std::size_t>(configuration.verletClusterSize) << 52u);
   }
 };
 
@@ -6,7 +6,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <cmath>
+#include <iterator>
 #include <vector>
 
 #include "autopas/containers/ParticleContainer.h"
@@ -20,6 +23,8 @@
 #include "autopas/containers/verletListsCellBased/verletListsCells/VerletListsCells.h"
 #include "autopas/options/ContainerOption.h"
 #include "autopas/selectors/ContainerSelectorInfo.h"
+#include "autopas/selectors/TraversalSelectorInfo.h"
+#include "autopas/utils/ArrayMath.h"
 #include "autopas/utils/StringUtils.h"
 
 namespace autopas {
@@ -41,9 +46,19 @@ class ContainerSelector {
    * @param boxMin Lower corner of the container.
    * @param boxMax Upper corner of the container.
    * @param cutoff Cutoff radius to be used in this container.
+   * @param incrementalRebuildThreshold Fraction of the skin that is passed to VerletLists. Zero disables incremental
+   * rebuilds.
+   * @param useCompactNeighborLists Whether VerletLists store their neighbor lists with 32 bit indices.
    */
-  ContainerSelector(const std::array<double, 3> &boxMin, const std::array<double, 3> &boxMax, double cutoff)
-      : _boxMin(boxMin), _boxMax(boxMax), _cutoff(cutoff), _currentContainer(nullptr), _currentInfo() {}
+  ContainerSelector(const std::array<double, 3> &boxMin, const std::array<double, 3> &boxMax, double cutoff,
+                    double incrementalRebuildThreshold = 0., bool useCompactNeighborLists = false)
+      : _boxMin(boxMin),
+        _boxMax(boxMax),
+        _cutoff(cutoff),
+        _incrementalRebuildThreshold(incrementalRebuildThreshold),
+        _useCompactNeighborLists(useCompactNeighborLists),
+        _currentContainer(nullptr),
+        _currentInfo() {}
 
   /**
    * Sets the container to the given option.
@@ -64,7 +79,30 @@ class ContainerSelector {
    */
   std::shared_ptr<const autopas::ParticleContainerInterface<ParticleCell>> getCurrentContainer() const;
 
+  /**
+   * Get the traversal info a container would provide without building the container.
+   *
+   * For containers whose cell structure only depends on the domain geometry the info is derived from box, cutoff, skin
+   * and cell size factor. Containers whose structure depends on the particle distribution (verlet cluster containers)
+   * are generated and selected as current container.
+   *
+   * @param containerOption
+   * @param containerInfo
+   * @return Info that the container would pass to its traversals.
+   */
+  TraversalSelectorInfo getTraversalSelectorInfo(ContainerOption containerOption,
+                                                 const ContainerSelectorInfo &containerInfo);
+
  private:
+  /**
+   * Calculates the traversal info of a container that is based on a CellBlock3D.
+   * This mirrors the cell calculation of CellBlock3D::rebuild().
+   * @param interactionLength
+   * @param cellSizeFactor
+   * @return
+   */
+  TraversalSelectorInfo generateCellBlockTraversalSelectorInfo(double interactionLength, double cellSizeFactor) const;
+
   /**
    * Container factory that also copies all particles to the new container
    * @param containerChoice container to generate
@@ -74,8 +112,20 @@ class ContainerSelector {
   std::unique_ptr<autopas::ParticleContainerInterface<ParticleCell>> generateContainer(
       ContainerOption containerChoice, ContainerSelectorInfo containerInfo);
 
+  /**
+   * Moves all particles from the current container into the given one.
+   * Particles are extracted in parallel into flat buffers, sorted by their target cell and, if the new container
+   * supports it, inserted in parallel.
+   * @param newContainer Freshly generated container.
+   * @param containerChoice Type of newContainer.
+   */
+  void transferParticles(autopas::ParticleContainerInterface<ParticleCell> &newContainer,
+                         ContainerOption containerChoice);
+
   const std::array<double, 3> _boxMin, _boxMax;
   const double _cutoff;
+  const double _incrementalRebuildThreshold;
+  const bool _useCompactNeighborLists;
   std::shared_ptr<autopas::ParticleContainerInterface<ParticleCell>> _currentContainer;
   ContainerSelectorInfo _currentInfo;
 };
@@ -99,7 +149,8 @@ ContainerSelector<Particle, ParticleCell>::generateContainer(ContainerOption con
     case ContainerOption::verletLists: {
       container = std::make_unique<VerletLists<Particle>>(_boxMin, _boxMax, _cutoff, containerInfo.verletSkin,
                                                           VerletLists<Particle>::BuildVerletListType::VerletSoA,
-                                                          containerInfo.cellSizeFactor);
+                                                          containerInfo.cellSizeFactor, _incrementalRebuildThreshold,
+                                                          _useCompactNeighborLists);
       break;
     }
     case ContainerOption::verletListsCells: {
@@ -108,7 +159,8 @@ ContainerSelector<Particle, ParticleCell>::generateContainer(ContainerOption con
       break;
     }
     case ContainerOption::verletClusterLists: {
-      container = std::make_unique<VerletClusterLists<Particle>>(_boxMin, _boxMax, _cutoff, containerInfo.verletSkin);
+      container = std::make_unique<VerletClusterLists<Particle>>(_boxMin, _boxMax, _cutoff, containerInfo.verletSkin,
+                                                                 containerInfo.verletClusterSize);
       break;
     }
     case ContainerOption::verletClusterCells: {
@@ -127,20 +179,106 @@ ContainerSelector<Particle, ParticleCell>::generateContainer(ContainerOption con
     }
   }
 
-  // copy particles so they do not get lost when container is switched
+  // move particles so they do not get lost when container is switched
   if (_currentContainer != nullptr) {
+    transferParticles(*container, containerChoice);
+  }
+
+  return container;
+}
+
+template <class Particle, class ParticleCell>
+void ContainerSelector<Particle, ParticleCell>::transferParticles(
+    autopas::ParticleContainerInterface<ParticleCell> &newContainer, ContainerOption containerChoice) {
+  std::vector<Particle> ownedParticles, haloParticles;
+  ownedParticles.reserve(_currentContainer->getNumParticles());
+
+  // extract all particles into flat buffers. The old container is discarded afterwards so we can move.
+#ifdef AUTOPAS_OPENMP
+#pragma omp parallel
+#endif
+  {
+    std::vector<Particle> myOwnedParticles, myHaloParticles;
+    // the iterator distributes the cells among the threads of the parallel region
     for (auto particleIter = _currentContainer->begin(IteratorBehavior::haloAndOwned); particleIter.isValid();
          ++particleIter) {
-      // add particle as inner if it is owned
       if (particleIter->isOwned()) {
-        container->addParticle(*particleIter);
+        myOwnedParticles.push_back(std::move(*particleIter));
       } else {
-        container->addHaloParticle(*particleIter);
+        myHaloParticles.push_back(std::move(*particleIter));
       }
     }
+#ifdef AUTOPAS_OPENMP
+#pragma omp critical
+#endif
+    {
+      ownedParticles.insert(ownedParticles.end(), std::make_move_iterator(myOwnedParticles.begin()),
+                            std::make_move_iterator(myOwnedParticles.end()));
+      haloParticles.insert(haloParticles.end(), std::make_move_iterator(myHaloParticles.begin()),
+                           std::make_move_iterator(myHaloParticles.end()));
+    }
   }
 
-  return container;
+  // Only containers built on a CellBlock3D have a meaningful cell grid at this point. For those, sort the particles
+  // by their target cell so that consecutive insertions touch the same cell and chunks of the buffer map to disjoint
+  // cells.
+  bool cellBased = false;
+  switch (containerChoice) {
+    case ContainerOption::linkedCells:
+    case ContainerOption::verletLists:
+    case ContainerOption::verletListsCells:
+    case ContainerOption::varVerletListsAsBuild: {
+      cellBased = true;
+      break;
+    }
+    default:
+      break;
+  }
+  if (cellBased) {
+    const auto info = newContainer.getTraversalSelectorInfo();
+    // cell index in the same layout as CellBlock3D (x fastest). Indices of halo cells may be negative, which does not
+    // matter for sorting.
+    auto cellIndex = [&](const Particle &p) {
+      std::array<long, 3> index3D{};
+      for (int d = 0; d < 3; ++d) {
+        index3D[d] = static_cast<long>(std::floor((p.getR()[d] - _boxMin[d]) / info.cellLength[d]));
+      }
+      return index3D[0] + static_cast<long>(info.dims[0]) *
+                              (index3D[1] + static_cast<long>(info.dims[1]) * index3D[2]);
+    };
+    auto byCell = [&](const Particle &a, const Particle &b) { return cellIndex(a) < cellIndex(b); };
+    std::sort(ownedParticles.begin(), ownedParticles.end(), byCell);
+    std::sort(haloParticles.begin(), haloParticles.end(), byCell);
+  }
+
+  // LinkedCells::addParticle() only locks the target cell so it can be called concurrently.
+  // All other containers modify shared state on insertion.
+  if (containerChoice == ContainerOption::linkedCells) {
+#ifdef AUTOPAS_OPENMP
+#pragma omp parallel
+#endif
+    {
+#ifdef AUTOPAS_OPENMP
+#pragma omp for schedule(static) nowait
+#endif
+      for (size_t i = 0; i < ownedParticles.size(); ++i) {
+        newContainer.addParticle(ownedParticles[i]);
+      }
+#ifdef AUTOPAS_OPENMP
+#pragma omp for schedule(static)
+#endif
+      for (size_t i = 0; i < haloParticles.size(); ++i) {
+        newContainer.addHaloParticle(haloParticles[i]);
+      }
+    }
+  } else {
+    for (auto &p : ownedParticles) {
+      newContainer.addParticle(p);
+    }
+    for (auto &p : haloParticles) {
+      newContainer.addHaloParticle(p);
+    }
+  }
 }
 
 template <class Particle, class ParticleCell>
@@ -163,6 +301,62 @@ ContainerSelector<Particle, ParticleCell>::getCurrentContainer() const {
   return _currentContainer;
 }
 
+template <class Particle, class ParticleCell>
+TraversalSelectorInfo ContainerSelector<Particle, ParticleCell>::getTraversalSelectorInfo(
+    ContainerOption containerOption, const ContainerSelectorInfo &containerInfo) {
+  // if we already have this container just ask it
+  if (_currentContainer != nullptr and _currentContainer->getContainerType() == containerOption and
+      _currentInfo == containerInfo) {
+    return _currentContainer->getTraversalSelectorInfo();
+  }
+
+  const double interactionLength = _cutoff + containerInfo.verletSkin;
+  switch (containerOption) {
+    case ContainerOption::directSum: {
+      // see DirectSum::getTraversalSelectorInfo()
+      return TraversalSelectorInfo({2, 0, 0}, _cutoff, utils::ArrayMath::sub(_boxMax, _boxMin), 0);
+    }
+    case ContainerOption::linkedCells: {
+      return generateCellBlockTraversalSelectorInfo(interactionLength, containerInfo.cellSizeFactor);
+    }
+    case ContainerOption::verletLists:
+    case ContainerOption::verletListsCells: {
+      // see VerletListsLinkedBase
+      return generateCellBlockTraversalSelectorInfo(interactionLength, std::max(1.0, containerInfo.cellSizeFactor));
+    }
+    case ContainerOption::varVerletListsAsBuild: {
+      // see generateContainer(): VarVerletLists are always built with cell size factor 1
+      return generateCellBlockTraversalSelectorInfo(interactionLength, 1.0);
+    }
+    default: {
+      // the cell structure depends on the particles so the container has to be built
+      selectContainer(containerOption, containerInfo);
+      return _currentContainer->getTraversalSelectorInfo();
+    }
+  }
+}
+
+template <class Particle, class ParticleCell>
+TraversalSelectorInfo ContainerSelector<Particle, ParticleCell>::generateCellBlockTraversalSelectorInfo(
+    double interactionLength, double cellSizeFactor) const {
+  const unsigned long cellsPerInteractionLength =
+      cellSizeFactor >= 1.0 ? 1ul : static_cast<unsigned long>(std::ceil(1.0 / cellSizeFactor));
+
+  std::array<unsigned long, 3> cellsPerDimWithHalo{};
+  std::array<double, 3> cellLength{};
+  for (int d = 0; d < 3; ++d) {
+    const double diff = _boxMax[d] - _boxMin[d];
+    auto cellsPerDim = static_cast<unsigned long>(std::floor(diff / (interactionLength * cellSizeFactor)));
+    // at least one central cell
+    cellsPerDim = std::max(cellsPerDim, 1ul);
+
+    cellsPerDimWithHalo[d] = cellsPerDim + 2 * cellsPerInteractionLength;
+    cellLength[d] = diff / cellsPerDim;
+  }
+
+  return TraversalSelectorInfo(cellsPerDimWithHalo, interactionLength, cellLength, 0);
+}
+
 template <class Particle, class ParticleCell>
 void ContainerSelector<Particle, ParticleCell>::selectContainer(ContainerOption containerOption,
                                                                 ContainerSelectorInfo containerInfo) {
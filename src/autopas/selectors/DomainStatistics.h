@@ -0,0 +1,112 @@
+/**
+ * @file DomainStatistics.h
+ * @author F. Gratl
+ * @date 17.10.26
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
+#include "autopas/iterators/ParticleIteratorInterface.h"
+
+namespace autopas {
+
+/**
+ * Cheap statistics of the current simulation domain on which pruning rules can be based.
+ */
+struct DomainStatistics {
+  /**
+   * Number of owned particles.
+   */
+  unsigned long numParticles{0};
+  /**
+   * Mean number of owned particles per cell when the domain is divided into cells with side length cutoff.
+   */
+  double meanParticlesPerCell{0.};
+  /**
+   * Variance of the number of owned particles per cell. Homogeneous systems have small values.
+   */
+  double particlesPerCellVariance{0.};
+  /**
+   * Fraction of the cells that hold at least one owned particle.
+   */
+  double occupiedCellFraction{0.};
+  /**
+   * Number of threads available for the traversals.
+   */
+  int numThreads{1};
+  /**
+   * Cutoff radius of the container, which is also the side length of the cells the statistics refer to.
+   */
+  double cutoff{1.};
+
+  /**
+   * Collects the statistics from the owned particles of the given container.
+   *
+   * Particles are sorted into a grid with cell side length cutoff independent of the container type. Only occupied
+   * cells are stored so the cost is linear in the number of particles.
+   *
+   * @tparam Container
+   * @param container
+   * @param numThreads
+   * @return
+   */
+  template <class Container>
+  static DomainStatistics collect(const Container &container, int numThreads) {
+    DomainStatistics statistics;
+    statistics.numThreads = numThreads;
+    statistics.cutoff = container.getCutoff();
+
+    const auto &boxMin = container.getBoxMin();
+    const auto &boxMax = container.getBoxMax();
+    const double cellLength = statistics.cutoff;
+    std::array<long, 3> cellsPerDim{};
+    double numCells = 1.;
+    for (size_t d = 0; d < 3; ++d) {
+      cellsPerDim[d] = std::max(1l, static_cast<long>(std::ceil((boxMax[d] - boxMin[d]) / cellLength)));
+      numCells *= cellsPerDim[d];
+    }
+
+    std::unordered_map<long, unsigned long> particlesPerOccupiedCell;
+    for (auto iter = container.begin(IteratorBehavior::ownedOnly); iter.isValid(); ++iter) {
+      const auto &r = iter->getR();
+      std::array<long, 3> cellIndex3D{};
+      for (size_t d = 0; d < 3; ++d) {
+        cellIndex3D[d] = std::clamp(static_cast<long>((r[d] - boxMin[d]) / cellLength), 0l, cellsPerDim[d] - 1);
+      }
+      ++particlesPerOccupiedCell[(cellIndex3D[2] * cellsPerDim[1] + cellIndex3D[1]) * cellsPerDim[0] + cellIndex3D[0]];
+      ++statistics.numParticles;
+    }
+
+    statistics.meanParticlesPerCell = statistics.numParticles / numCells;
+    statistics.occupiedCellFraction = particlesPerOccupiedCell.size() / numCells;
+    // empty cells contribute (0 - mean)^2 each, which is accounted for by E[X^2] - E[X]^2
+    double sumOfSquares = 0.;
+    for (const auto &[_, count] : particlesPerOccupiedCell) {
+      sumOfSquares += static_cast<double>(count) * count;
+    }
+    statistics.particlesPerCellVariance =
+        sumOfSquares / numCells - statistics.meanParticlesPerCell * statistics.meanParticlesPerCell;
+    return statistics;
+  }
+
+  /**
+   * Returns string representation.
+   * @return
+   */
+  std::string toString() const {
+    std::ostringstream ss;
+    ss << "{Particles: " << numParticles << " , Particles per cell: " << meanParticlesPerCell
+       << " , Variance: " << particlesPerCellVariance << " , Occupied cells: " << occupiedCellFraction
+       << " , Threads: " << numThreads << " , Cutoff: " << cutoff << "}";
+    return ss.str();
+  }
+};
+
+}  // namespace autopas
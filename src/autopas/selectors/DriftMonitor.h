@@ -0,0 +1,118 @@
+/**
+ * @file DriftMonitor.h
+ * @author F. Gratl
+ * @date 16.10.26
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <deque>
+
+namespace autopas {
+
+/**
+ * Watches the iteration times of the active configuration outside of tuning phases and detects when they drift away
+ * from the times observed directly after the last tuning phase.
+ *
+ * The first windowSize measurements after a reset form the baseline. Afterwards the mean of the last windowSize
+ * measurements is compared to the baseline mean. A drift is reported if they differ by more than threshold baseline
+ * standard deviations. To not react to noise when the baseline is very stable, the standard deviation is bounded below
+ * by minRelativeDeviation times the baseline mean.
+ */
+class DriftMonitor {
+ public:
+  /**
+   * Constructor.
+   * @param threshold Number of baseline standard deviations the recent mean may differ from the baseline mean.
+   * @param windowSize Number of measurements forming the baseline and the recent window.
+   * @param minRelativeDeviation Lower bound for the baseline standard deviation relative to the baseline mean.
+   */
+  DriftMonitor(double threshold, size_t windowSize, double minRelativeDeviation = 0.05)
+      : _threshold(threshold), _windowSize(std::max(windowSize, size_t{1})), _minRelativeDeviation(minRelativeDeviation) {}
+
+  /**
+   * Discard all measurements and start collecting a new baseline.
+   */
+  void reset() {
+    _baselineCount = 0;
+    _baselineMean = 0.;
+    _baselineM2 = 0.;
+    _recent.clear();
+    _recentSum = 0.;
+  }
+
+  /**
+   * Add the time of one iteration.
+   * @param time
+   */
+  void addMeasurement(long time) {
+    const auto value = static_cast<double>(time);
+    if (_baselineCount < _windowSize) {
+      // Welford's online algorithm
+      ++_baselineCount;
+      const double delta = value - _baselineMean;
+      _baselineMean += delta / _baselineCount;
+      _baselineM2 += delta * (value - _baselineMean);
+      return;
+    }
+
+    _recent.push_back(value);
+    _recentSum += value;
+    if (_recent.size() > _windowSize) {
+      _recentSum -= _recent.front();
+      _recent.pop_front();
+    }
+  }
+
+  /**
+   * Checks whether the recent measurements deviate significantly from the baseline.
+   * @return False as long as the baseline or the recent window are not filled.
+   */
+  bool driftDetected() const {
+    if (_recent.size() < _windowSize) {
+      return false;
+    }
+    return std::abs(getRecentMean() - _baselineMean) > _threshold * getBaselineDeviation();
+  }
+
+  /**
+   * Get the mean of the baseline measurements.
+   * @return
+   */
+  double getBaselineMean() const { return _baselineMean; }
+
+  /**
+   * Get the mean of the recent window.
+   * @return
+   */
+  double getRecentMean() const { return _recent.empty() ? 0. : _recentSum / _recent.size(); }
+
+ private:
+  /**
+   * Standard deviation of the baseline bounded below by _minRelativeDeviation * _baselineMean.
+   * @return
+   */
+  double getBaselineDeviation() const {
+    const double stdDev = _baselineCount > 1 ? std::sqrt(_baselineM2 / (_baselineCount - 1)) : 0.;
+    return std::max(stdDev, _minRelativeDeviation * _baselineMean);
+  }
+
+  double _threshold;
+  size_t _windowSize;
+  double _minRelativeDeviation;
+
+  size_t _baselineCount{0};
+  double _baselineMean{0.};
+  /**
+   * Sum of squared differences from the baseline mean.
+   */
+  double _baselineM2{0.};
+
+  std::deque<double> _recent;
+  double _recentSum{0.};
+};
+
+}  // namespace autopas
@@ -7,6 +7,8 @@
 #pragma once
 
 #include <Eigen/Dense>
+#include <cmath>
+#include <optional>
 #include <vector>
 
 #include "autopas/selectors/Configuration.h"
@@ -23,14 +25,16 @@ class FeatureVector : public Configuration {
   /**
    * Number of tune-able dimensions.
    */
-  static constexpr size_t featureSpaceDims = 4;
+  static constexpr size_t featureSpaceDims = 10;
 
   /**
    * Dimensions of a one-hot-encoded vector
-   * = 1 (cellSizeFactor) + traversals + dataLayouts + newton3
+   * = 1 (cellSizeFactor) + 1 (verletSkin) + 1 (verletRebuildFrequency) + 1 (numThreads) + 1 (scheduleChunkSize) +
+   * 1 (verletClusterSize) + traversals + dataLayouts + newton3 + schedules
    */
-  inline static size_t oneHotDims = 1 + TraversalOption::getOptionNames().size() +
-                                    DataLayoutOption::getOptionNames().size() + Newton3Option::getOptionNames().size();
+  inline static size_t oneHotDims = 6 + TraversalOption::getOptionNames().size() +
+                                    DataLayoutOption::getOptionNames().size() + Newton3Option::getOptionNames().size() +
+                                    ScheduleOption::getOptionNames().size();
 
   /**
    * Default constructor. Results in invalid vector.
@@ -44,10 +48,20 @@ class FeatureVector : public Configuration {
    * @param dataLayout
    * @param newton3
    * @param cellSizeFactor
+   * @param verletSkin
+   * @param verletRebuildFrequency
+   * @param numThreads
+   * @param schedule
+   * @param scheduleChunkSize
+   * @param verletClusterSize
    */
   FeatureVector(ContainerOption container, double cellSizeFactor, TraversalOption traversal,
-                DataLayoutOption dataLayout, Newton3Option newton3)
-      : Configuration(container, cellSizeFactor, traversal, dataLayout, newton3) {}
+                DataLayoutOption dataLayout, Newton3Option newton3, double verletSkin = 0.,
+                unsigned int verletRebuildFrequency = 1, unsigned int numThreads = 0,
+                ScheduleOption schedule = ScheduleOption::dynamicSchedule, unsigned int scheduleChunkSize = 1,
+                unsigned int verletClusterSize = 4)
+      : Configuration(container, cellSizeFactor, traversal, dataLayout, newton3, verletSkin, verletRebuildFrequency,
+                      numThreads, schedule, scheduleChunkSize, verletClusterSize) {}
 
   /**
    * Construct from Configuration.
@@ -66,7 +80,11 @@ class FeatureVector : public Configuration {
   Eigen::VectorXd operator-(const FeatureVector &other) const {
     Eigen::VectorXd result(featureSpaceDims);
     result << cellSizeFactor - other.cellSizeFactor, traversal == other.traversal ? 0. : 1.,
-        dataLayout == other.dataLayout ? 0. : 1., newton3 == other.newton3 ? 0. : 1.;
+        dataLayout == other.dataLayout ? 0. : 1., newton3 == other.newton3 ? 0. : 1., verletSkin - other.verletSkin,
+        static_cast<double>(verletRebuildFrequency) - static_cast<double>(other.verletRebuildFrequency),
+        static_cast<double>(numThreads) - static_cast<double>(other.numThreads), schedule == other.schedule ? 0. : 1.,
+        static_cast<double>(scheduleChunkSize) - static_cast<double>(other.scheduleChunkSize),
+        static_cast<double>(verletClusterSize) - static_cast<double>(other.verletClusterSize);
 
     return result;
   }
@@ -78,7 +96,9 @@ class FeatureVector : public Configuration {
   operator Eigen::VectorXd() const {
     Eigen::VectorXd result(featureSpaceDims);
     result << cellSizeFactor, static_cast<double>(traversal), static_cast<double>(dataLayout),
-        static_cast<double>(newton3);
+        static_cast<double>(newton3), verletSkin, static_cast<double>(verletRebuildFrequency),
+        static_cast<double>(numThreads), static_cast<double>(schedule), static_cast<double>(scheduleChunkSize),
+        static_cast<double>(verletClusterSize);
 
     return result;
   }
@@ -92,6 +112,11 @@ class FeatureVector : public Configuration {
     data.reserve(oneHotDims);
 
     data.push_back(cellSizeFactor);
+    data.push_back(verletSkin);
+    data.push_back(static_cast<double>(verletRebuildFrequency));
+    data.push_back(static_cast<double>(numThreads));
+    data.push_back(static_cast<double>(scheduleChunkSize));
+    data.push_back(static_cast<double>(verletClusterSize));
     for (auto &[option, _] : TraversalOption::getOptionNames()) {
       data.push_back((option == traversal) ? 1. : 0.);
     }
@@ -101,6 +126,9 @@ class FeatureVector : public Configuration {
     for (auto &[option, _] : Newton3Option::getOptionNames()) {
       data.push_back((option == newton3) ? 1. : 0.);
     }
+    for (auto &[option, _] : ScheduleOption::getOptionNames()) {
+      data.push_back((option == schedule) ? 1. : 0.);
+    }
 
     return Eigen::Map<Eigen::VectorXd>(data.data(), oneHotDims);
   }
@@ -120,6 +148,11 @@ class FeatureVector : public Configuration {
 
     size_t pos = 0;
     double cellSizeFactor = vec[pos++];
+    double verletSkin = vec[pos++];
+    auto verletRebuildFrequency = static_cast<unsigned int>(std::lround(vec[pos++]));
+    auto numThreads = static_cast<unsigned int>(std::lround(vec[pos++]));
+    auto scheduleChunkSize = static_cast<unsigned int>(std::lround(vec[pos++]));
+    auto verletClusterSize = static_cast<unsigned int>(std::lround(vec[pos++]));
 
     // get traversal
     std::optional<TraversalOption> traversal{};
@@ -172,7 +205,25 @@ class FeatureVector : public Configuration {
           "FeatureVector.oneHotDecode: Vector encodes no newton3. (All values for newton3 equal 0.)");
     }
 
-    return FeatureVector(ContainerOption(), cellSizeFactor, *traversal, *dataLayout, *newton3);
+    // get schedule
+    std::optional<ScheduleOption> schedule = {};
+    for (auto &[option, _] : ScheduleOption::getOptionNames()) {
+      if (vec[pos++] == 1.) {
+        if (schedule) {
+          utils::ExceptionHandler::exception(
+              "FeatureVector.oneHotDecode: Vector encodes more than one schedule. (More than one value for schedule "
+              "equals 1.)");
+        }
+        schedule = option;
+      }
+    }
+    if (not schedule) {
+      utils::ExceptionHandler::exception(
+          "FeatureVector.oneHotDecode: Vector encodes no schedule. (All values for schedule equal 0.)");
+    }
+
+    return FeatureVector(ContainerOption(), cellSizeFactor, *traversal, *dataLayout, *newton3, verletSkin,
+                         verletRebuildFrequency, numThreads, *schedule, scheduleChunkSize, verletClusterSize);
   }
 
   /**
@@ -185,21 +236,39 @@ class FeatureVector : public Configuration {
    * @param traversals
    * @param dataLayouts
    * @param newton3
+   * @param verletSkins
+   * @param verletRebuildFrequencies
+   * @param numThreads
+   * @param schedules
+   * @param scheduleChunkSizes
+   * @param verletClusterSizes
    * @return vector of sample featureVectors
    */
   static std::vector<FeatureVector> lhsSampleFeatures(size_t n, Random &rng, const NumberSet<double> &cellSizeFactors,
                                                       const std::set<TraversalOption> &traversals,
                                                       const std::set<DataLayoutOption> &dataLayouts,
-                                                      const std::set<Newton3Option> &newton3) {
+                                                      const std::set<Newton3Option> &newton3,
+                                                      const NumberSet<double> &verletSkins,
+                                                      const std::set<unsigned int> &verletRebuildFrequencies,
+                                                      const std::set<unsigned int> &numThreads,
+                                                      const std::set<ScheduleOption> &schedules,
+                                                      const std::set<unsigned int> &scheduleChunkSizes,
+                                                      const std::set<unsigned int> &verletClusterSizes) {
     // create n samples from each set
     auto csf = cellSizeFactors.uniformSample(n, rng);
     auto tr = rng.uniformSample(traversals, n);
     auto dl = rng.uniformSample(dataLayouts, n);
     auto n3 = rng.uniformSample(newton3, n);
+    auto skin = verletSkins.uniformSample(n, rng);
+    auto rf = rng.uniformSample(verletRebuildFrequencies, n);
+    auto th = rng.uniformSample(numThreads, n);
+    auto sc = rng.uniformSample(schedules, n);
+    auto cs = rng.uniformSample(scheduleChunkSizes, n);
+    auto cl = rng.uniformSample(verletClusterSizes, n);
 
     std::vector<FeatureVector> result;
     for (size_t i = 0; i < n; ++i) {
-      result.emplace_back(ContainerOption(), csf[i], tr[i], dl[i], n3[i]);
+      result.emplace_back(ContainerOption(), csf[i], tr[i], dl[i], n3[i], skin[i], rf[i], th[i], sc[i], cs[i], cl[i]);
     }
 
     return result;
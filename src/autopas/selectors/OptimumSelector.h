@@ -7,6 +7,10 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <iterator>
+#include <limits>
 #include <numeric>
 #include <vector>
 
@@ -51,6 +55,67 @@ inline unsigned long medianValue(std::vector<unsigned long> values) {
   return values[(values.size() - 1) / 2];
 }
 
+/**
+ * Removes values that are far away from the median.
+ *
+ * A value is an outlier if it deviates from the median by more than threshold times the scaled median absolute
+ * deviation (MAD), which estimates the standard deviation of normally distributed values without being affected by
+ * the outliers themselves. The MAD is bounded below by 1% of the median so that values of a very stable measurement
+ * are not rejected because of timer resolution. Vectors with less than three values are returned unchanged.
+ *
+ * @param values
+ * @param threshold Number of estimated standard deviations a value may deviate from the median.
+ * @return All values that are not outliers in their original order.
+ */
+inline std::vector<unsigned long> rejectOutliers(const std::vector<unsigned long> &values, double threshold = 3.) {
+  if (values.size() < 3) return values;
+
+  const auto median = static_cast<double>(medianValue(values));
+  std::vector<unsigned long> deviations;
+  deviations.reserve(values.size());
+  for (auto value : values) {
+    deviations.push_back(static_cast<unsigned long>(std::abs(static_cast<double>(value) - median)));
+  }
+  // 1.4826 scales the MAD to the standard deviation of a normal distribution
+  const double deviation = std::max(1.4826 * medianValue(deviations), 0.01 * median);
+
+  std::vector<unsigned long> inliers;
+  inliers.reserve(values.size());
+  std::copy_if(values.cbegin(), values.cend(), std::back_inserter(inliers), [&](unsigned long value) {
+    return std::abs(static_cast<double>(value) - median) <= threshold * deviation;
+  });
+  return inliers;
+}
+
+/**
+ * Half width of the 95% confidence interval of the mean relative to the mean.
+ *
+ * Uses the quantiles of Student's t-distribution, so small sample counts lead to wide intervals.
+ *
+ * @param values
+ * @return Relative half width or infinity if less than two values are given.
+ */
+inline double relativeConfidenceIntervalWidth(const std::vector<unsigned long> &values) {
+  if (values.size() < 2) return std::numeric_limits<double>::infinity();
+
+  // two-sided 95% quantiles of the t-distribution for 1 to 30 degrees of freedom
+  constexpr std::array<double, 30> tQuantiles{12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+                                              2.201,  2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+                                              2.080,  2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+  const size_t degreesOfFreedom = values.size() - 1;
+  const double tQuantile = degreesOfFreedom <= tQuantiles.size() ? tQuantiles[degreesOfFreedom - 1] : 1.96;
+
+  const double mean = std::accumulate(values.cbegin(), values.cend(), 0.) / values.size();
+  if (mean == 0.) return 0.;
+  double sumSquaredDiffs = 0.;
+  for (auto value : values) {
+    sumSquaredDiffs += (value - mean) * (value - mean);
+  }
+  const double stdDev = std::sqrt(sumSquaredDiffs / degreesOfFreedom);
+
+  return tQuantile * stdDev / std::sqrt(static_cast<double>(values.size())) / mean;
+}
+
 /**
  * Optimal value according to passed strategy.
  * @param values
@@ -0,0 +1,156 @@
+/**
+ * @file RuleBasedPruning.h
+ * @author F. Gratl
+ * @date 16.10.26
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <set>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "autopas/options/ContainerOption.h"
+#include "autopas/options/DataLayoutOption.h"
+#include "autopas/options/Newton3Option.h"
+#include "autopas/options/TraversalOption.h"
+#include "autopas/selectors/Configuration.h"
+#include "autopas/selectors/DomainStatistics.h"
+#include "autopas/utils/Logger.h"
+
+namespace autopas {
+
+/**
+ * A rule that excludes all configurations matching a pattern from tuning while its condition holds.
+ *
+ * Empty option sets in the pattern match every option.
+ */
+struct PruningRule {
+  /**
+   * Human readable explanation used in log messages.
+   */
+  std::string description;
+  /**
+   * Containers this rule applies to.
+   */
+  std::set<ContainerOption> containers{};
+  /**
+   * Traversals this rule applies to.
+   */
+  std::set<TraversalOption> traversals{};
+  /**
+   * Data layouts this rule applies to.
+   */
+  std::set<DataLayoutOption> dataLayouts{};
+  /**
+   * Newton 3 options this rule applies to.
+   */
+  std::set<Newton3Option> newton3Options{};
+  /**
+   * The matching configurations are pruned iff this returns true for the current domain.
+   */
+  std::function<bool(const DomainStatistics &)> condition;
+
+  /**
+   * Checks whether the configuration falls under this rule.
+   * @param configuration
+   * @return
+   */
+  bool matches(const Configuration &configuration) const {
+    return matchesOption(containers, configuration.container) and
+           matchesOption(traversals, configuration.traversal) and
+           matchesOption(dataLayouts, configuration.dataLayout) and
+           matchesOption(newton3Options, configuration.newton3);
+  }
+
+ private:
+  template <class Option>
+  static bool matchesOption(const std::set<Option> &options, const Option &option) {
+    return options.empty() or options.count(option) > 0;
+  }
+};
+
+/**
+ * Excludes configurations from tuning phases based on rules about the current domain.
+ *
+ * The statistics are updated once at the start of every tuning phase so the rules are evaluated against the scenario
+ * the phase is tuning for.
+ */
+class RuleBasedPruning {
+ public:
+  /**
+   * Constructor.
+   * @param rules
+   */
+  explicit RuleBasedPruning(std::vector<PruningRule> rules) : _rules(std::move(rules)) {}
+
+  /**
+   * Set the statistics the rules are evaluated against.
+   * @param statistics
+   */
+  void setStatistics(const DomainStatistics &statistics) {
+    _statistics = statistics;
+    AutoPasLog(debug, "Pruning rules are evaluated for domain {}", _statistics.toString());
+  }
+
+  /**
+   * Get the statistics the rules are evaluated against.
+   * @return
+   */
+  const DomainStatistics &getStatistics() const { return _statistics; }
+
+  /**
+   * Find the first rule which prunes the given configuration.
+   * @param configuration
+   * @return Pointer to the rule or nullptr if the configuration may be tested.
+   */
+  const PruningRule *findPruningRule(const Configuration &configuration) const {
+    for (const auto &rule : _rules) {
+      if (rule.matches(configuration) and rule.condition(_statistics)) {
+        return &rule;
+      }
+    }
+    return nullptr;
+  }
+
+  /**
+   * Rules for configurations that are known to lose in certain regimes.
+   * @return
+   */
+  static std::vector<PruningRule> getDefaultRules() {
+    return {
+        {"directSum scales quadratically with the number of particles",
+         {ContainerOption::directSum},
+         {},
+         {},
+         {},
+         [](const DomainStatistics &statistics) { return statistics.numParticles > 5000; }},
+        {"c18 has too little parallelism per color for many threads",
+         {},
+         {TraversalOption::c18},
+         {},
+         {},
+         [](const DomainStatistics &statistics) { return statistics.numThreads > 16; }},
+        {"AoS is outperformed by SoA for large homogeneous systems",
+         {},
+         {},
+         {DataLayoutOption::aos},
+         {},
+         [](const DomainStatistics &statistics) {
+           // for uniformly distributed particles the variance equals the mean
+           return statistics.numParticles > 100000 and
+                  statistics.particlesPerCellVariance < 2. * statistics.meanParticlesPerCell;
+         }},
+    };
+  }
+
+ private:
+  std::vector<PruningRule> _rules;
+  DomainStatistics _statistics;
+};
+
+}  // namespace autopas
@@ -0,0 +1,257 @@
+/**
+ * @file TelemetryWriter.h
+ * @author F. Gratl
+ * @date 17.10.26
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "autopas/options/TelemetryFormatOption.h"
+#include "autopas/selectors/Configuration.h"
+#include "autopas/utils/Logger.h"
+
+namespace autopas {
+
+/**
+ * Measurements of one call to AutoPas::iteratePairwise().
+ */
+struct IterationTelemetry {
+  /**
+   * Number of iteratePairwise() calls before this one.
+   */
+  size_t iteration{0};
+  /**
+   * Configuration the iteration used.
+   */
+  Configuration configuration{};
+  /**
+   * Whether the iteration was part of a tuning phase.
+   */
+  bool isTuning{false};
+  /**
+   * Time of all container updates since the previous iteration in nanoseconds.
+   */
+  long containerUpdateTime{0};
+  /**
+   * Time of the neighbor list rebuild in nanoseconds. Zero if the lists were not rebuilt.
+   */
+  long rebuildTime{0};
+  /**
+   * Time to initialize the traversal in nanoseconds, which mainly is loading the SoA buffers.
+   */
+  long soaLoadTime{0};
+  /**
+   * Time of the pairwise traversal in nanoseconds without loading and extracting the SoA buffers.
+   */
+  long traversalTime{0};
+  /**
+   * Time to finalize the traversal in nanoseconds, which mainly is extracting the SoA buffers.
+   */
+  long soaExtractTime{0};
+  /**
+   * Number of owned particles.
+   */
+  unsigned long numParticlesOwned{0};
+  /**
+   * Number of halo particles.
+   */
+  unsigned long numParticlesHalo{0};
+};
+
+/**
+ * Writes one record per iteration to a CSV or JSON lines file.
+ *
+ * Records are collected in a buffer by the simulation thread. Full buffers are handed to a background thread which
+ * formats and writes them, so recording an iteration only costs a copy of the record. Remaining records are written
+ * when the writer is destroyed. The file is overwritten on construction.
+ */
+class TelemetryWriter {
+ public:
+  /**
+   * Constructor. Opens the file and starts the background thread.
+   * @param filename Path to the telemetry file.
+   * @param format
+   * @param bufferSize Number of records that are collected before they are handed to the background thread.
+   */
+  TelemetryWriter(std::string filename, TelemetryFormatOption format, size_t bufferSize = 1024)
+      : _filename(std::move(filename)),
+        _format(format),
+        _bufferSize(std::max<size_t>(1, bufferSize)),
+        _out(_filename, std::ios::trunc) {
+    if (not _out.is_open()) {
+      AutoPasLog(warn, "TelemetryWriter: Could not write to {}", _filename);
+    }
+    _out << std::setprecision(std::numeric_limits<double>::max_digits10);
+    if (_format == TelemetryFormatOption::csv) {
+      _out << getCsvHeader() << '\n';
+    }
+    _buffer.reserve(_bufferSize);
+    _worker = std::thread([this]() { writeLoop(); });
+  }
+
+  /**
+   * Destructor. Writes all remaining records and stops the background thread.
+   */
+  ~TelemetryWriter() {
+    flush();
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _stop = true;
+    }
+    _condition.notify_one();
+    _worker.join();
+  }
+
+  TelemetryWriter(const TelemetryWriter &) = delete;
+
+  TelemetryWriter &operator=(const TelemetryWriter &) = delete;
+
+  /**
+   * Add the record of one iteration. Hands the buffer to the background thread when it is full.
+   * @param telemetry
+   */
+  void record(const IterationTelemetry &telemetry) {
+    _buffer.push_back(telemetry);
+    if (_buffer.size() >= _bufferSize) {
+      flush();
+    }
+  }
+
+  /**
+   * Hand all buffered records to the background thread without waiting for them to be written.
+   */
+  void flush() {
+    if (_buffer.empty()) {
+      return;
+    }
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _pending.push_back(std::move(_buffer));
+    }
+    _condition.notify_one();
+    _buffer = {};
+    _buffer.reserve(_bufferSize);
+  }
+
+  /**
+   * Get the path to the telemetry file.
+   * @return
+   */
+  const std::string &getFilename() const { return _filename; }
+
+  /**
+   * Column names of the CSV format.
+   * @return
+   */
+  static std::string getCsvHeader() {
+    return "iteration,container,cellSizeFactor,traversal,dataLayout,newton3,verletSkin,verletRebuildFrequency,"
+           "numThreads,schedule,scheduleChunkSize,verletClusterSize,isTuning,containerUpdateTime,rebuildTime,"
+           "soaLoadTime,traversalTime,soaExtractTime,numParticlesOwned,numParticlesHalo";
+  }
+
+  /**
+   * Formats a record as one line of the CSV format.
+   * @param out
+   * @param telemetry
+   */
+  static void writeCsv(std::ostream &out, const IterationTelemetry &telemetry) {
+    const auto &configuration = telemetry.configuration;
+    out << telemetry.iteration << ',' << configuration.container.to_string() << ',' << configuration.cellSizeFactor
+        << ',' << configuration.traversal.to_string() << ',' << configuration.dataLayout.to_string() << ','
+        << configuration.newton3.to_string() << ',' << configuration.verletSkin << ','
+        << configuration.verletRebuildFrequency << ',' << configuration.numThreads << ','
+        << configuration.schedule.to_string() << ',' << configuration.scheduleChunkSize << ','
+        << configuration.verletClusterSize << ',' << telemetry.isTuning << ',' << telemetry.containerUpdateTime << ','
+        << telemetry.rebuildTime << ',' << telemetry.soaLoadTime << ',' << telemetry.traversalTime << ','
+        << telemetry.soaExtractTime << ',' << telemetry.numParticlesOwned << ',' << telemetry.numParticlesHalo << '\n';
+  }
+
+  /**
+   * Formats a record as one line of the JSON lines format.
+   * @param out
+   * @param telemetry
+   */
+  static void writeJson(std::ostream &out, const IterationTelemetry &telemetry) {
+    const auto &configuration = telemetry.configuration;
+    out << "{\"iteration\":" << telemetry.iteration << ",\"container\":\"" << configuration.container.to_string()
+        << "\",\"cellSizeFactor\":" << configuration.cellSizeFactor << ",\"traversal\":\""
+        << configuration.traversal.to_string() << "\",\"dataLayout\":\"" << configuration.dataLayout.to_string()
+        << "\",\"newton3\":\"" << configuration.newton3.to_string() << "\",\"verletSkin\":" << configuration.verletSkin
+        << ",\"verletRebuildFrequency\":" << configuration.verletRebuildFrequency
+        << ",\"numThreads\":" << configuration.numThreads << ",\"schedule\":\"" << configuration.schedule.to_string()
+        << "\",\"scheduleChunkSize\":" << configuration.scheduleChunkSize
+        << ",\"verletClusterSize\":" << configuration.verletClusterSize
+        << ",\"isTuning\":" << (telemetry.isTuning ? "true" : "false")
+        << ",\"containerUpdateTime\":" << telemetry.containerUpdateTime << ",\"rebuildTime\":" << telemetry.rebuildTime
+        << ",\"soaLoadTime\":" << telemetry.soaLoadTime << ",\"traversalTime\":" << telemetry.traversalTime
+        << ",\"soaExtractTime\":" << telemetry.soaExtractTime
+        << ",\"numParticlesOwned\":" << telemetry.numParticlesOwned
+        << ",\"numParticlesHalo\":" << telemetry.numParticlesHalo << "}\n";
+  }
+
+ private:
+  /**
+   * Body of the background thread. Writes handed over buffers until the writer is destroyed.
+   */
+  void writeLoop() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true) {
+      _condition.wait(lock, [this]() { return _stop or not _pending.empty(); });
+      if (_pending.empty()) {
+        // only reached if stopped and everything is written
+        break;
+      }
+      auto batches = std::move(_pending);
+      _pending.clear();
+      lock.unlock();
+      for (const auto &batch : batches) {
+        for (const auto &telemetry : batch) {
+          if (_format == TelemetryFormatOption::csv) {
+            writeCsv(_out, telemetry);
+          } else {
+            writeJson(_out, telemetry);
+          }
+        }
+      }
+      _out.flush();
+      lock.lock();
+    }
+  }
+
+  std::string _filename;
+  TelemetryFormatOption _format;
+  size_t _bufferSize;
+  /**
+   * Only accessed by the background thread once it is started.
+   */
+  std::ofstream _out;
+
+  /**
+   * Records of the simulation thread that are not handed over yet.
+   */
+  std::vector<IterationTelemetry> _buffer;
+  /**
+   * Buffers that wait to be written by the background thread. Guarded by _mutex.
+   */
+  std::vector<std::vector<IterationTelemetry>> _pending;
+  /**
+   * Tells the background thread to terminate once _pending is empty. Guarded by _mutex.
+   */
+  bool _stop{false};
+  std::mutex _mutex;
+  std::condition_variable _condition;
+  std::thread _worker;
+};
+
+}  // namespace autopas
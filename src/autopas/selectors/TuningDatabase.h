@@ -0,0 +1,217 @@
+/**
+ * @file TuningDatabase.h
+ * @author F. Gratl
+ * @date 16.10.26
+ */
+
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <optional>
+#include <sstream>
+#include <string>
+
+#include "autopas/selectors/Configuration.h"
+#include "autopas/utils/ExceptionHandler.h"
+#include "autopas/utils/Logger.h"
+
+namespace autopas {
+
+/**
+ * Description of a simulation scenario which is used to decide whether a stored tuning result can be reused.
+ *
+ * Continuous properties (particle count, density) are sorted into logarithmic buckets so that similar scenarios map to
+ * the same fingerprint.
+ */
+class ScenarioFingerprint {
+ public:
+  /**
+   * Default constructor. Results in an invalid fingerprint.
+   */
+  ScenarioFingerprint() = default;
+
+  /**
+   * Constructor.
+   * @param boxMin Lower corner of the domain.
+   * @param boxMax Upper corner of the domain.
+   * @param cutoff Cutoff radius.
+   * @param numParticles Number of particles (owned and halo) in the domain.
+   * @param numThreads Number of threads available for the traversals.
+   * @param functorType Name of the type of the functor that is tuned for.
+   */
+  ScenarioFingerprint(const std::array<double, 3> &boxMin, const std::array<double, 3> &boxMax, double cutoff,
+                      unsigned long numParticles, int numThreads, std::string functorType)
+      : cutoff(cutoff), numThreads(numThreads), functorType(std::move(functorType)) {
+    double volume = 1.;
+    for (size_t d = 0; d < 3; ++d) {
+      const double boxLength = boxMax[d] - boxMin[d];
+      boxShape[d] = static_cast<unsigned long>(std::ceil(boxLength / cutoff));
+      volume *= boxLength;
+    }
+    particleCountBucket = numParticles == 0 ? -1 : static_cast<int>(std::lround(std::log2(numParticles)));
+    // density in particles per cutoff volume
+    const double density = numParticles * cutoff * cutoff * cutoff / volume;
+    densityBucket = density <= 0. ? std::numeric_limits<int>::min() : static_cast<int>(std::lround(std::log2(density)));
+  }
+
+  /**
+   * Returns a whitespace free string representation which is used as key in the tuning database.
+   * @return String representation.
+   */
+  std::string toString() const {
+    std::ostringstream ss;
+    ss << "cutoff=" << cutoff << ",box=" << boxShape[0] << "x" << boxShape[1] << "x" << boxShape[2]
+       << ",particles=2^" << particleCountBucket << ",density=2^" << densityBucket << ",threads=" << numThreads
+       << ",functor=" << functorType;
+    return ss.str();
+  }
+
+  /**
+   * Cutoff radius.
+   */
+  double cutoff{-1.};
+  /**
+   * Number of cells with side length cutoff that are needed to cover the box in each dimension.
+   */
+  std::array<unsigned long, 3> boxShape{0, 0, 0};
+  /**
+   * Rounded base two logarithm of the number of particles.
+   */
+  int particleCountBucket{-1};
+  /**
+   * Rounded base two logarithm of the number of particles per cutoff volume.
+   */
+  int densityBucket{-1};
+  /**
+   * Number of threads.
+   */
+  int numThreads{0};
+  /**
+   * Name of the functor type.
+   */
+  std::string functorType{};
+};
+
+/**
+ * Persistent storage for the results of tuning phases.
+ *
+ * Maps scenario fingerprints to the optimal configuration found for them. The database is kept in a plain text file
+ * where every line holds one entry:
+ * @code
+ * <fingerprint> <container> <cellSizeFactor> <traversal> <dataLayout> <newton3> <verletSkin> <verletRebuildFrequency>
+ * <numThreads> <schedule> <scheduleChunkSize> <verletClusterSize>
+ * @endcode
+ * The file is read on construction and rewritten whenever a new result is stored.
+ */
+class TuningDatabase {
+ public:
+  /**
+   * Constructor. Loads all entries from the given file if it exists.
+   * @param filename Path to the database file.
+   */
+  explicit TuningDatabase(std::string filename) : _filename(std::move(filename)) { load(); }
+
+  /**
+   * Get the stored optimum for the given scenario.
+   * @param fingerprint
+   * @return Optimal configuration or nothing if the scenario is unknown.
+   */
+  std::optional<Configuration> lookup(const ScenarioFingerprint &fingerprint) const {
+    auto entry = _entries.find(fingerprint.toString());
+    if (entry == _entries.end()) {
+      return std::nullopt;
+    }
+    return entry->second;
+  }
+
+  /**
+   * Store the optimum for the given scenario and write the database to disk. Existing entries are overwritten.
+   * @param fingerprint
+   * @param configuration
+   */
+  void store(const ScenarioFingerprint &fingerprint, const Configuration &configuration) {
+    _entries[fingerprint.toString()] = configuration;
+    save();
+  }
+
+  /**
+   * Get the number of stored scenarios.
+   * @return
+   */
+  size_t size() const { return _entries.size(); }
+
+  /**
+   * Get the path to the database file.
+   * @return
+   */
+  const std::string &getFilename() const { return _filename; }
+
+ private:
+  /**
+   * Read all entries from _filename. A missing file is treated as an empty database, malformed lines are skipped.
+   */
+  void load() {
+    std::ifstream in(_filename);
+    if (not in.is_open()) {
+      AutoPasLog(debug, "TuningDatabase: Could not open {}. Starting with an empty database.", _filename);
+      return;
+    }
+
+    std::string line;
+    while (std::getline(in, line)) {
+      if (line.empty()) {
+        continue;
+      }
+      std::istringstream ss(line);
+      std::string key, container, traversal, dataLayout, newton3, schedule;
+      double cellSizeFactor, verletSkin;
+      unsigned int verletRebuildFrequency, numThreads, scheduleChunkSize, verletClusterSize;
+      if (not(ss >> key >> container >> cellSizeFactor >> traversal >> dataLayout >> newton3 >> verletSkin >>
+              verletRebuildFrequency >> numThreads >> schedule >> scheduleChunkSize >> verletClusterSize)) {
+        AutoPasLog(warn, "TuningDatabase: Skipping malformed entry: {}", line);
+        continue;
+      }
+      try {
+        _entries[key] = Configuration(
+            ContainerOption::parseOptionExact(container), cellSizeFactor, TraversalOption::parseOptionExact(traversal),
+            DataLayoutOption::parseOptionExact(dataLayout), Newton3Option::parseOptionExact(newton3), verletSkin,
+            verletRebuildFrequency, numThreads, ScheduleOption::parseOptionExact(schedule), scheduleChunkSize,
+            verletClusterSize);
+      } catch (const utils::ExceptionHandler::AutoPasException &) {
+        AutoPasLog(warn, "TuningDatabase: Skipping entry with unknown option: {}", line);
+      }
+    }
+    AutoPasLog(debug, "TuningDatabase: Loaded {} entries from {}", _entries.size(), _filename);
+  }
+
+  /**
+   * Write all entries to _filename.
+   */
+  void save() const {
+    std::ofstream out(_filename, std::ios::trunc);
+    if (not out.is_open()) {
+      AutoPasLog(warn, "TuningDatabase: Could not write to {}", _filename);
+      return;
+    }
+    // make sure cell size factors and skins can be read back exactly
+    out << std::setprecision(std::numeric_limits<double>::max_digits10);
+    for (const auto &[key, configuration] : _entries) {
+      out << key << " " << configuration.container.to_string() << " " << configuration.cellSizeFactor << " "
+          << configuration.traversal.to_string() << " " << configuration.dataLayout.to_string() << " "
+          << configuration.newton3.to_string() << " " << configuration.verletSkin << " "
+          << configuration.verletRebuildFrequency << " " << configuration.numThreads << " "
+          << configuration.schedule.to_string() << " " << configuration.scheduleChunkSize << " "
+          << configuration.verletClusterSize << std::endl;
+    }
+  }
+
+  std::string _filename;
+  std::map<std::string, Configuration> _entries;
+};
+
+}  // namespace autopas
@@ -0,0 +1,176 @@
+/**
+ * @file TuningRecorder.h
+ * @author F. Gratl
+ * @date 16.10.26
+ */
+
+#pragma once
+
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "autopas/selectors/Configuration.h"
+#include "autopas/utils/ExceptionHandler.h"
+#include "autopas/utils/Logger.h"
+
+namespace autopas {
+
+/**
+ * All measurements the AutoTuner took for one configuration before passing them on as evidence.
+ */
+struct TuningRecord {
+  /**
+   * Iteration in which the last sample was taken.
+   */
+  size_t iteration{0};
+  /**
+   * Configuration that was measured.
+   */
+  Configuration configuration{};
+  /**
+   * Number of particles in the container.
+   */
+  unsigned long numParticles{0};
+  /**
+   * Value that was passed to the tuning strategy as evidence.
+   */
+  size_t reducedValue{0};
+  /**
+   * Traversal times in nanoseconds.
+   */
+  std::vector<size_t> samples{};
+  /**
+   * Neighbor list rebuild times in nanoseconds.
+   */
+  std::vector<size_t> rebuildSamples{};
+};
+
+/**
+ * Writes every evidence the AutoTuner collects to a plain text file, so tuning strategies can be compared offline by
+ * replaying it.
+ *
+ * Every line of the file holds one record:
+ * @code
+ * <iteration> <container> <cellSizeFactor> <traversal> <dataLayout> <newton3> <verletSkin> <verletRebuildFrequency>
+ * <numThreads> <schedule> <scheduleChunkSize> <verletClusterSize> <numParticles> <reducedValue> <numSamples>
+ * <samples...> <numRebuildSamples> <rebuildSamples...>
+ * @endcode
+ * The file is overwritten on construction. Records are buffered by the stream and written when the recorder is
+ * destroyed at the latest.
+ */
+class TuningRecorder {
+ public:
+  /**
+   * Constructor. Opens the file for writing.
+   * @param filename Path to the record file.
+   */
+  explicit TuningRecorder(std::string filename) : _filename(std::move(filename)), _out(_filename, std::ios::trunc) {
+    if (not _out.is_open()) {
+      AutoPasLog(warn, "TuningRecorder: Could not write to {}", _filename);
+    }
+    // make sure cell size factors and skins can be read back exactly
+    _out << std::setprecision(std::numeric_limits<double>::max_digits10);
+  }
+
+  /**
+   * Append one record to the file.
+   * @param record
+   */
+  void record(const TuningRecord &record) {
+    const auto &configuration = record.configuration;
+    _out << record.iteration << " " << configuration.container.to_string() << " " << configuration.cellSizeFactor
+         << " " << configuration.traversal.to_string() << " " << configuration.dataLayout.to_string() << " "
+         << configuration.newton3.to_string() << " " << configuration.verletSkin << " "
+         << configuration.verletRebuildFrequency << " " << configuration.numThreads << " "
+         << configuration.schedule.to_string() << " " << configuration.scheduleChunkSize << " "
+         << configuration.verletClusterSize << " " << record.numParticles << " " << record.reducedValue << " "
+         << record.samples.size();
+    for (auto sample : record.samples) {
+      _out << " " << sample;
+    }
+    _out << " " << record.rebuildSamples.size();
+    for (auto sample : record.rebuildSamples) {
+      _out << " " << sample;
+    }
+    _out << '\n';
+  }
+
+  /**
+   * Get the path to the record file.
+   * @return
+   */
+  const std::string &getFilename() const { return _filename; }
+
+  /**
+   * Read all records from a file written by a TuningRecorder. Malformed lines are skipped.
+   * @param filename
+   * @return Records in the order of the file.
+   */
+  static std::vector<TuningRecord> read(const std::string &filename) {
+    std::ifstream in(filename);
+    if (not in.is_open()) {
+      utils::ExceptionHandler::exception("TuningRecorder: Could not open {}", filename);
+    }
+
+    std::vector<TuningRecord> records;
+    std::string line;
+    while (std::getline(in, line)) {
+      if (line.empty()) {
+        continue;
+      }
+      std::istringstream ss(line);
+      TuningRecord record;
+      std::string container, traversal, dataLayout, newton3, schedule;
+      double cellSizeFactor, verletSkin;
+      unsigned int verletRebuildFrequency, numThreads, scheduleChunkSize, verletClusterSize;
+      size_t numSamples, numRebuildSamples;
+      if (not(ss >> record.iteration >> container >> cellSizeFactor >> traversal >> dataLayout >> newton3 >>
+              verletSkin >> verletRebuildFrequency >> numThreads >> schedule >> scheduleChunkSize >>
+              verletClusterSize >> record.numParticles >> record.reducedValue >> numSamples) or
+          not readSamples(ss, numSamples, record.samples) or not(ss >> numRebuildSamples) or
+          not readSamples(ss, numRebuildSamples, record.rebuildSamples)) {
+        AutoPasLog(warn, "TuningRecorder: Skipping malformed record: {}", line);
+        continue;
+      }
+      try {
+        record.configuration = Configuration(
+            ContainerOption::parseOptionExact(container), cellSizeFactor, TraversalOption::parseOptionExact(traversal),
+            DataLayoutOption::parseOptionExact(dataLayout), Newton3Option::parseOptionExact(newton3), verletSkin,
+            verletRebuildFrequency, numThreads, ScheduleOption::parseOptionExact(schedule), scheduleChunkSize,
+            verletClusterSize);
+      } catch (const utils::ExceptionHandler::AutoPasException &) {
+        AutoPasLog(warn, "TuningRecorder: Skipping record with unknown option: {}", line);
+        continue;
+      }
+      records.push_back(std::move(record));
+    }
+    return records;
+  }
+
+ private:
+  /**
+   * Read a given number of samples from a stream.
+   * @param ss
+   * @param numSamples
+   * @param samples
+   * @return true iff all samples could be read.
+   */
+  static bool readSamples(std::istringstream &ss, size_t numSamples, std::vector<size_t> &samples) {
+    samples.resize(numSamples);
+    for (auto &sample : samples) {
+      if (not(ss >> sample)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  std::string _filename;
+  std::ofstream _out;
+};
+
+}  // namespace autopas
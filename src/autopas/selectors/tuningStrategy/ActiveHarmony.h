@@ -27,17 +27,35 @@ class ActiveHarmony : public TuningStrategyInterface {
    * @param allowedTraversalOptions
    * @param allowedDataLayoutOptions
    * @param allowedNewton3Options
+   * @param allowedVerletSkins
+   * @param allowedVerletRebuildFrequencies
+   * @param allowedNumThreads
+   * @param allowedScheduleOptions
+   * @param allowedScheduleChunkSizes
+   * @param allowedVerletClusterSizes
    */
   ActiveHarmony(const std::set<ContainerOption> &allowedContainerOptions = ContainerOption::getAllOptions(),
                 const NumberSet<double> &allowedCellSizeFactors = NumberInterval<double>(1., 2.),
                 const std::set<TraversalOption> &allowedTraversalOptions = TraversalOption::getAllOptions(),
                 const std::set<DataLayoutOption> &allowedDataLayoutOptions = DataLayoutOption::getAllOptions(),
-                const std::set<Newton3Option> &allowedNewton3Options = Newton3Option::getAllOptions())
+                const std::set<Newton3Option> &allowedNewton3Options = Newton3Option::getAllOptions(),
+                const NumberSet<double> &allowedVerletSkins = NumberSetFinite<double>({0.}),
+                const std::set<unsigned int> &allowedVerletRebuildFrequencies = {1},
+                const std::set<unsigned int> &allowedNumThreads = {0},
+                const std::set<ScheduleOption> &allowedScheduleOptions = {ScheduleOption::dynamicSchedule},
+                const std::set<unsigned int> &allowedScheduleChunkSizes = {1},
+                const std::set<unsigned int> &allowedVerletClusterSizes = {4})
       : _allowedContainerOptions(),
         _allowedCellSizeFactors(allowedCellSizeFactors.clone()),
         _allowedTraversalOptions(allowedTraversalOptions),
         _allowedDataLayoutOptions(allowedDataLayoutOptions),
         _allowedNewton3Options(allowedNewton3Options),
+        _allowedVerletSkins(allowedVerletSkins.clone()),
+        _allowedVerletRebuildFrequencies(allowedVerletRebuildFrequencies),
+        _allowedNumThreads(allowedNumThreads),
+        _allowedScheduleOptions(allowedScheduleOptions),
+        _allowedScheduleChunkSizes(allowedScheduleChunkSizes),
+        _allowedVerletClusterSizes(allowedVerletClusterSizes),
         _currentConfig() {
     // reduce traversal and container option to possible combinations
     for (auto &traversalOption : _allowedTraversalOptions) {
@@ -80,6 +98,10 @@ class ActiveHarmony : public TuningStrategyInterface {
 
   inline const Configuration &getCurrentConfiguration() const override;
 
+  inline bool setCurrentConfiguration(const Configuration &configuration) override;
+
+  inline bool searchSpaceContains(const Configuration &configuration) const override;
+
   inline void reset() override;
 
   inline std::set<ContainerOption> getAllowedContainerOptions() const override;
@@ -99,6 +121,12 @@ class ActiveHarmony : public TuningStrategyInterface {
   std::set<TraversalOption> _allowedTraversalOptions;
   std::set<DataLayoutOption> _allowedDataLayoutOptions;
   std::set<Newton3Option> _allowedNewton3Options;
+  std::unique_ptr<NumberSet<double>> _allowedVerletSkins;
+  std::set<unsigned int> _allowedVerletRebuildFrequencies;
+  std::set<unsigned int> _allowedNumThreads;
+  std::set<ScheduleOption> _allowedScheduleOptions;
+  std::set<unsigned int> _allowedScheduleChunkSizes;
+  std::set<unsigned int> _allowedVerletClusterSizes;
 
   Configuration _currentConfig;
 
@@ -124,6 +152,23 @@ class ActiveHarmony : public TuningStrategyInterface {
   template <class O>
   inline void configureTuningParameter(hdef_t *hdef, const char *name, const std::set<O> options);
 
+  /**
+   * Define an integer tuning parameter in the ActiveHarmony tuning definition as enum and set possible values.
+   * @param hdef Pointer to ActiveHarmony tuning definition.
+   * @param name Name of the tuning parameter.
+   * @param options Set of possible values of the tuning parameter.
+   */
+  inline void configureTuningParameter(hdef_t *hdef, const char *name, const std::set<unsigned int> &options);
+
+  /**
+   * Define a floating point tuning parameter in the ActiveHarmony tuning definition.
+   * Finite sets are defined as enum, intervals as real.
+   * @param hdef Pointer to ActiveHarmony tuning definition.
+   * @param name Name of the tuning parameter.
+   * @param options Set of possible values of the tuning parameter.
+   */
+  inline void configureTuningParameter(hdef_t *hdef, const char *name, const NumberSet<double> &options);
+
   /**
    * Fetch value for enum-type tuning parameter.
    * @tparam O Option class.
@@ -134,12 +179,37 @@ class ActiveHarmony : public TuningStrategyInterface {
   template <class O>
   inline O fetchTuningParameter(const char *name, const std::set<O> options);
 
+  /**
+   * Fetch value for integer tuning parameter.
+   * @param name Name of the tuning parameter.
+   * @param options Set of all allowed values.
+   * @return Value for tuning parameter.
+   */
+  inline unsigned int fetchTuningParameter(const char *name, const std::set<unsigned int> &options);
+
+  /**
+   * Fetch value for floating point tuning parameter.
+   * @param name Name of the tuning parameter.
+   * @param options Set of all allowed values.
+   * @return Value for tuning parameter.
+   */
+  inline double fetchTuningParameter(const char *name, const NumberSet<double> &options);
+
+  /**
+   * Number of steps in which intervals of real valued parameters are sampled.
+   */
   static constexpr int cellSizeSamples = 100;
 
   static constexpr const char *traversalOptionName = "traversalOption";
   static constexpr const char *dataLayoutOptionName = "dataLayoutOption";
   static constexpr const char *cellSizeFactorsName = "cellSizeFactor";
   static constexpr const char *newton3OptionName = "newton3Option";
+  static constexpr const char *verletSkinsName = "verletSkin";
+  static constexpr const char *verletRebuildFrequenciesName = "verletRebuildFrequency";
+  static constexpr const char *numThreadsName = "numThreads";
+  static constexpr const char *scheduleOptionName = "scheduleOption";
+  static constexpr const char *scheduleChunkSizesName = "scheduleChunkSize";
+  static constexpr const char *verletClusterSizesName = "verletClusterSize";
 };
 
 void ActiveHarmony::addEvidence(long time) {
@@ -165,24 +235,47 @@ O ActiveHarmony::fetchTuningParameter(const char *name, const std::set<O> option
   return option;
 }
 
-void ActiveHarmony::fetchConfiguration() {
-  TraversalOption traversalOption = fetchTuningParameter(traversalOptionName, _allowedTraversalOptions);
-  DataLayoutOption dataLayoutOption = fetchTuningParameter(dataLayoutOptionName, _allowedDataLayoutOptions);
-  Newton3Option newton3Option = fetchTuningParameter(newton3OptionName, _allowedNewton3Options);
+unsigned int ActiveHarmony::fetchTuningParameter(const char *name, const std::set<unsigned int> &options) {
+  unsigned int value = 0;
+  if (options.size() > 1) {
+    value = static_cast<unsigned int>(std::stoul(ah_get_enum(htask, name)));
+  } else if (options.size() == 1) {
+    value = *options.begin();
+  }
+  return value;
+}
 
-  double cellSizeFactor = 0;
-  if (_allowedCellSizeFactors->isFinite()) {
-    if (_allowedCellSizeFactors->size() == 1) {
-      cellSizeFactor = _allowedCellSizeFactors->getMin();
-    } else if (_allowedCellSizeFactors->size() > 1) {
-      cellSizeFactor = std::strtod(ah_get_enum(htask, cellSizeFactorsName), nullptr);
+double ActiveHarmony::fetchTuningParameter(const char *name, const NumberSet<double> &options) {
+  double value = 0;
+  if (options.isFinite()) {
+    if (options.size() == 1) {
+      value = options.getMin();
+    } else if (options.size() > 1) {
+      value = std::strtod(ah_get_enum(htask, name), nullptr);
     }
   } else {
-    cellSizeFactor = ah_get_real(htask, cellSizeFactorsName);
+    value = ah_get_real(htask, name);
   }
+  return value;
+}
 
-  _currentConfig = Configuration(*compatibleTraversals::allCompatibleContainers(traversalOption).begin(),
-                                 cellSizeFactor, traversalOption, dataLayoutOption, newton3Option);
+void ActiveHarmony::fetchConfiguration() {
+  TraversalOption traversalOption = fetchTuningParameter(traversalOptionName, _allowedTraversalOptions);
+  DataLayoutOption dataLayoutOption = fetchTuningParameter(dataLayoutOptionName, _allowedDataLayoutOptions);
+  Newton3Option newton3Option = fetchTuningParameter(newton3OptionName, _allowedNewton3Options);
+  double cellSizeFactor = fetchTuningParameter(cellSizeFactorsName, *_allowedCellSizeFactors);
+  double verletSkin = fetchTuningParameter(verletSkinsName, *_allowedVerletSkins);
+  unsigned int verletRebuildFrequency =
+      fetchTuningParameter(verletRebuildFrequenciesName, _allowedVerletRebuildFrequencies);
+  unsigned int numThreads = fetchTuningParameter(numThreadsName, _allowedNumThreads);
+  ScheduleOption scheduleOption = fetchTuningParameter(scheduleOptionName, _allowedScheduleOptions);
+  unsigned int scheduleChunkSize = fetchTuningParameter(scheduleChunkSizesName, _allowedScheduleChunkSizes);
+  unsigned int verletClusterSize = fetchTuningParameter(verletClusterSizesName, _allowedVerletClusterSizes);
+
+  _currentConfig =
+      Configuration(*compatibleTraversals::allCompatibleContainers(traversalOption).begin(), cellSizeFactor,
+                    traversalOption, dataLayoutOption, newton3Option, verletSkin, verletRebuildFrequency, numThreads,
+                    scheduleOption, scheduleChunkSize, verletClusterSize);
 }
 
 bool ActiveHarmony::invalidateConfiguration() {
@@ -242,6 +335,28 @@ void ActiveHarmony::removeN3Option(Newton3Option option) {
 
 const Configuration &ActiveHarmony::getCurrentConfiguration() const { return _currentConfig; }
 
+bool ActiveHarmony::setCurrentConfiguration(const Configuration &configuration) {
+  if (not searchSpaceContains(configuration)) {
+    return false;
+  }
+  _currentConfig = configuration;
+  return true;
+}
+
+bool ActiveHarmony::searchSpaceContains(const Configuration &configuration) const {
+  return _allowedContainerOptions.count(configuration.container) > 0 and
+         _allowedTraversalOptions.count(configuration.traversal) > 0 and
+         _allowedDataLayoutOptions.count(configuration.dataLayout) > 0 and
+         _allowedNewton3Options.count(configuration.newton3) > 0 and
+         _allowedCellSizeFactors->contains(configuration.cellSizeFactor) and
+         _allowedVerletSkins->contains(configuration.verletSkin) and
+         _allowedVerletRebuildFrequencies.count(configuration.verletRebuildFrequency) > 0 and
+         _allowedNumThreads.count(configuration.numThreads) > 0 and
+         _allowedScheduleOptions.count(configuration.schedule) > 0 and
+         _allowedScheduleChunkSizes.count(configuration.scheduleChunkSize) > 0 and
+         _allowedVerletClusterSizes.count(configuration.verletClusterSize) > 0;
+}
+
 template <class O>
 void ActiveHarmony::configureTuningParameter(hdef_t *hdef, const char *name, const std::set<O> options) {
   if (options.size() > 1) {                       // only parameters with more than 1 possible options should be tuned
@@ -259,6 +374,48 @@ void ActiveHarmony::configureTuningParameter(hdef_t *hdef, const char *name, con
   }
 }
 
+void ActiveHarmony::configureTuningParameter(hdef_t *hdef, const char *name, const std::set<unsigned int> &options) {
+  if (options.size() > 1) {
+    if (ah_def_enum(hdef, name, nullptr) != 0) {
+      utils::ExceptionHandler::exception("ActiveHarmony::configureTuningParameter: Error defining enum \"{}\"", name);
+    }
+    for (auto option : options) {
+      if (ah_def_enum_value(hdef, name, std::to_string(option).c_str()) != 0) {
+        utils::ExceptionHandler::exception(
+            "ActiveHarmony::configureTuningParameter: Error defining enum value for enum \"{}\"", name);
+      }
+    }
+  } else {
+    AutoPasLog(debug, "ActiveHarmony::configureTuningParameter: Skipping trivial parameter {}", name);
+  }
+}
+
+void ActiveHarmony::configureTuningParameter(hdef_t *hdef, const char *name, const NumberSet<double> &options) {
+  if (options.isFinite()) {  // finite sets => define parameter as enum
+    if (options.size() == 1) {
+      AutoPasLog(debug, "ActiveHarmony::configureTuningParameter: Skipping trivial parameter {}", name);
+    } else if (options.size() > 1) {
+      AutoPasLog(debug, "ActiveHarmony::configureTuningParameter: Finite {}; defining parameter as enum", name);
+      if (ah_def_enum(hdef, name, nullptr) != 0) {
+        utils::ExceptionHandler::exception("ActiveHarmony::configureTuningParameter: Error defining enum \"{}\"",
+                                           name);
+      }
+      for (auto value : options.getAll()) {
+        if (ah_def_enum_value(hdef, name, std::to_string(value).c_str()) != 0) {
+          utils::ExceptionHandler::exception(
+              "ActiveHarmony::configureTuningParameter: Error defining enum value for enum \"{}\"", name);
+        }
+      }
+    }
+  } else {  // intervals => define parameter as real
+    AutoPasLog(debug, "ActiveHarmony::configureTuningParameter: Infinite {}; defining parameter as real", name);
+    if (ah_def_real(hdef, name, options.getMin(), options.getMax(),
+                    (options.getMax() - options.getMin()) / cellSizeSamples, nullptr) != 0) {
+      utils::ExceptionHandler::exception("ActiveHarmony::configureTuningParameter: Error defining real \"{}\"", name);
+    }
+  }
+}
+
 void ActiveHarmony::reset() {
   // free memory
   if (htask != nullptr) {
@@ -293,35 +450,17 @@ void ActiveHarmony::reset() {
       utils::ExceptionHandler::exception("ActiveHarmony::reset: Error settings search name");
     }
 
-    if (_allowedCellSizeFactors->isFinite()) {  // finite cell-size factors => define parameter as enum
-      if (_allowedCellSizeFactors->size() == 1) {
-        AutoPasLog(debug, "ActiveHarmony::reset: Skipping trivial parameter {}", cellSizeFactorsName);
-      } else if (_allowedCellSizeFactors->size() > 1) {
-        AutoPasLog(debug, "ActiveHarmony::reset: Finite cell-size factors; defining parameter as enum");
-        if (ah_def_enum(hdef, cellSizeFactorsName, nullptr) != 0) {
-          utils::ExceptionHandler::exception("ActiveHarmony::configureTuningParameter: Error defining enum \"{}\"",
-                                             cellSizeFactorsName);
-        }
-        for (auto cellSizeFactor : _allowedCellSizeFactors->getAll()) {
-          if (ah_def_enum_value(hdef, cellSizeFactorsName, std::to_string(cellSizeFactor).c_str()) != 0) {
-            utils::ExceptionHandler::exception(
-                "ActiveHarmony::configureTuningParameter: Error defining enum value for enum \"{}\"",
-                cellSizeFactorsName);
-          }
-        }
-      }
-    } else {  // infinite cell-size factors => define parameter as real
-      AutoPasLog(debug, "ActiveHarmony::reset: Infinite cell-size factors; defining parameter as real");
-      if (ah_def_real(hdef, cellSizeFactorsName, _allowedCellSizeFactors->getMin(), _allowedCellSizeFactors->getMax(),
-                      (_allowedCellSizeFactors->getMin(), _allowedCellSizeFactors->getMax()) / cellSizeSamples,
-                      nullptr) != 0) {
-        utils::ExceptionHandler::exception("ActiveHarmony::reset: Error defining real \"{}\"", cellSizeFactorsName);
-      }
-    }
-    // set up other parameters
+    // set up parameters
+    configureTuningParameter(hdef, cellSizeFactorsName, *_allowedCellSizeFactors);
     configureTuningParameter(hdef, traversalOptionName, _allowedTraversalOptions);
     configureTuningParameter(hdef, dataLayoutOptionName, _allowedDataLayoutOptions);
     configureTuningParameter(hdef, newton3OptionName, _allowedNewton3Options);
+    configureTuningParameter(hdef, verletSkinsName, *_allowedVerletSkins);
+    configureTuningParameter(hdef, verletRebuildFrequenciesName, _allowedVerletRebuildFrequencies);
+    configureTuningParameter(hdef, numThreadsName, _allowedNumThreads);
+    configureTuningParameter(hdef, scheduleOptionName, _allowedScheduleOptions);
+    configureTuningParameter(hdef, scheduleChunkSizesName, _allowedScheduleChunkSizes);
+    configureTuningParameter(hdef, verletClusterSizesName, _allowedVerletClusterSizes);
 
     // use ActiveHarmony's implementation of the Nelder-Mead method
     ah_def_strategy(hdef, "nm.so");
@@ -348,13 +487,20 @@ bool ActiveHarmony::searchSpaceIsTrivial() const {
   return _allowedContainerOptions.size() == 1 and
          (_allowedCellSizeFactors->isFinite() and _allowedCellSizeFactors->size() == 1) and
          _allowedTraversalOptions.size() == 1 and _allowedDataLayoutOptions.size() == 1 and
-         _allowedNewton3Options.size() == 1;
+         _allowedNewton3Options.size() == 1 and
+         (_allowedVerletSkins->isFinite() and _allowedVerletSkins->size() == 1) and
+         _allowedVerletRebuildFrequencies.size() == 1 and _allowedNumThreads.size() == 1 and
+         _allowedScheduleOptions.size() == 1 and _allowedScheduleChunkSizes.size() == 1 and
+         _allowedVerletClusterSizes.size() == 1;
 }
 
 bool ActiveHarmony::searchSpaceIsEmpty() const {
   return _allowedContainerOptions.empty() or
          (_allowedCellSizeFactors->isFinite() and _allowedCellSizeFactors->size() == 0) or
-         _allowedTraversalOptions.empty() or _allowedDataLayoutOptions.empty() or _allowedNewton3Options.empty();
+         _allowedTraversalOptions.empty() or _allowedDataLayoutOptions.empty() or _allowedNewton3Options.empty() or
+         (_allowedVerletSkins->isFinite() and _allowedVerletSkins->size() == 0) or
+         _allowedVerletRebuildFrequencies.empty() or _allowedNumThreads.empty() or _allowedScheduleOptions.empty() or
+         _allowedScheduleChunkSizes.empty() or _allowedVerletClusterSizes.empty();
 }
 
 }  // namespace autopas
@@ -8,9 +8,11 @@
 
 #include <limits>
 #include <map>
+#include <optional>
 #include <set>
 #include <unordered_set>
 
+#include "CostModel.h"
 #include "GaussianProcess.h"
 #include "TuningStrategyInterface.h"
 #include "autopas/selectors/ContainerSelector.h"
@@ -44,6 +46,12 @@ class BayesianSearch : public TuningStrategyInterface {
    * @param allowedDataLayoutOptions
    * @param allowedNewton3Options
    * @param allowedCellSizeFactors
+   * @param allowedVerletSkins
+   * @param allowedVerletRebuildFrequencies
+   * @param allowedNumThreads
+   * @param allowedScheduleOptions
+   * @param allowedScheduleChunkSizes
+   * @param allowedVerletClusterSizes
    * @param predAcqFunction acquisition function used for prediction while tuning.
    * @param predNumLHSamples number of samples used for prediction while tuning.
    * @param maxEvidence stop tuning after given number of evidence provided.
@@ -54,7 +62,12 @@ class BayesianSearch : public TuningStrategyInterface {
                  const std::set<TraversalOption> &allowedTraversalOptions = TraversalOption::getAllOptions(),
                  const std::set<DataLayoutOption> &allowedDataLayoutOptions = DataLayoutOption::getAllOptions(),
                  const std::set<Newton3Option> &allowedNewton3Options = Newton3Option::getAllOptions(),
-                 size_t maxEvidence = 10,
+                 const NumberSet<double> &allowedVerletSkins = NumberSetFinite<double>({0.}),
+                 const std::set<unsigned int> &allowedVerletRebuildFrequencies = {1},
+                 const std::set<unsigned int> &allowedNumThreads = {0},
+                 const std::set<ScheduleOption> &allowedScheduleOptions = {ScheduleOption::dynamicSchedule},
+                 const std::set<unsigned int> &allowedScheduleChunkSizes = {1},
+                 const std::set<unsigned int> &allowedVerletClusterSizes = {4}, size_t maxEvidence = 10,
                  AcquisitionFunctionOption predAcqFunction = AcquisitionFunctionOption::lowerConfidenceBound,
                  size_t predNumLHSamples = 1000, unsigned long seed = std::random_device()())
       : _containerOptions(allowedContainerOptions),
@@ -62,6 +75,12 @@ class BayesianSearch : public TuningStrategyInterface {
         _dataLayoutOptions(allowedDataLayoutOptions),
         _newton3Options(allowedNewton3Options),
         _cellSizeFactors(allowedCellSizeFactors.clone()),
+        _verletSkins(allowedVerletSkins.clone()),
+        _verletRebuildFrequencies(allowedVerletRebuildFrequencies),
+        _numThreads(allowedNumThreads),
+        _scheduleOptions(allowedScheduleOptions),
+        _scheduleChunkSizes(allowedScheduleChunkSizes),
+        _verletClusterSizes(allowedVerletClusterSizes),
         _traversalContainerMap(),
         _currentConfig(),
         _invalidConfigs(),
@@ -96,15 +115,53 @@ class BayesianSearch : public TuningStrategyInterface {
 
   inline const Configuration &getCurrentConfiguration() const override { return _currentConfig; }
 
+  inline bool setCurrentConfiguration(const Configuration &configuration) override;
+
+  inline bool searchSpaceContains(const Configuration &configuration) const override;
+
   inline void removeN3Option(Newton3Option badNewton3Option) override;
 
   inline void addEvidence(long time) override {
     // time is converted to seconds, to big values may lead to errors in GaussianProcess
     _gaussianProcess.addEvidence(_currentConfig.oneHotEncode(), time * secondsPerMicroseconds);
+    if (_costModel) {
+      _costModel->addEvidence(_currentConfig, time);
+    }
   }
 
   inline void reset() override {
-    _gaussianProcess.clear();
+    if (_costModel) {
+      updatePriorMean();
+    } else {
+      _gaussianProcess.clear();
+    }
+    tune();
+  }
+
+  inline void setDomainStatistics(const DomainStatistics &statistics) override {
+    if (_costModel) {
+      _costModel->setStatistics(statistics);
+    }
+  }
+
+  /**
+   * Use a CostModel as prior mean of the Gaussian process.
+   *
+   * Without evidence the search then starts at the configurations that are estimated to be fast instead of random
+   * ones. The model is calibrated with all evidence, but the prior only changes at the start of a tuning phase.
+   * @param useCostModel
+   */
+  inline void setUseCostModel(bool useCostModel) {
+    if (useCostModel == _costModel.has_value()) {
+      return;
+    }
+    if (useCostModel) {
+      _costModel.emplace();
+      updatePriorMean();
+    } else {
+      _costModel.reset();
+      _gaussianProcess.setPriorMean({});
+    }
     tune();
   }
 
@@ -127,11 +184,29 @@ class BayesianSearch : public TuningStrategyInterface {
    */
   inline FeatureVector sampleOptimalFeatureVector(size_t n, AcquisitionFunctionOption af);
 
+  /**
+   * Sets the current state of the cost model as prior mean of the Gaussian process, which discards its evidence.
+   */
+  inline void updatePriorMean() {
+    _gaussianProcess.setPriorMean([costModel = *_costModel, traversalContainerMap = _traversalContainerMap](
+                                      const Eigen::VectorXd &input) {
+      auto featureVector = FeatureVector::oneHotDecode(input);
+      featureVector.container = traversalContainerMap.at(featureVector.traversal);
+      return costModel.estimate(featureVector) * secondsPerMicroseconds;
+    });
+  }
+
   std::set<ContainerOption> _containerOptions;
   std::set<TraversalOption> _traversalOptions;
   std::set<DataLayoutOption> _dataLayoutOptions;
   std::set<Newton3Option> _newton3Options;
   std::unique_ptr<NumberSet<double>> _cellSizeFactors;
+  std::unique_ptr<NumberSet<double>> _verletSkins;
+  std::set<unsigned int> _verletRebuildFrequencies;
+  std::set<unsigned int> _numThreads;
+  std::set<ScheduleOption> _scheduleOptions;
+  std::set<unsigned int> _scheduleChunkSizes;
+  std::set<unsigned int> _verletClusterSizes;
 
   std::map<TraversalOption, ContainerOption> _traversalContainerMap;
 
@@ -143,6 +218,7 @@ class BayesianSearch : public TuningStrategyInterface {
   size_t _maxEvidence;
   AcquisitionFunctionOption _predAcqFunction;
   size_t _predNumLHSamples;
+  std::optional<CostModel> _costModel;
 };
 
 bool BayesianSearch::tune(bool currentInvalid) {
@@ -172,8 +248,10 @@ bool BayesianSearch::tune(bool currentInvalid) {
 FeatureVector BayesianSearch::sampleOptimalFeatureVector(size_t n, AcquisitionFunctionOption af) {
   for (size_t i = 0; i < maxAttempts; ++i) {
     // create n lhs samples
-    std::vector<FeatureVector> samples = FeatureVector::lhsSampleFeatures(n, _rng, *_cellSizeFactors, _traversalOptions,
-                                                                          _dataLayoutOptions, _newton3Options);
+    std::vector<FeatureVector> samples =
+        FeatureVector::lhsSampleFeatures(n, _rng, *_cellSizeFactors, _traversalOptions, _dataLayoutOptions,
+                                         _newton3Options, *_verletSkins, _verletRebuildFrequencies, _numThreads,
+                                         _scheduleOptions, _scheduleChunkSizes, _verletClusterSizes);
 
     // map container and calculate all acquisition function values
     std::map<FeatureVector, double> acquisitions;
@@ -226,13 +304,39 @@ bool BayesianSearch::searchSpaceIsTrivial() const {
   }
 
   return _containerOptions.size() == 1 and (_cellSizeFactors->isFinite() && _cellSizeFactors->size() == 1) and
-         _traversalOptions.size() == 1 and _dataLayoutOptions.size() == 1 and _newton3Options.size() == 1;
+         _traversalOptions.size() == 1 and _dataLayoutOptions.size() == 1 and _newton3Options.size() == 1 and
+         (_verletSkins->isFinite() && _verletSkins->size() == 1) and _verletRebuildFrequencies.size() == 1 and
+         _numThreads.size() == 1 and _scheduleOptions.size() == 1 and _scheduleChunkSizes.size() == 1 and
+         _verletClusterSizes.size() == 1;
 }
 
 bool BayesianSearch::searchSpaceIsEmpty() const {
   // if one enum is empty return true
   return _containerOptions.empty() or (_cellSizeFactors->isFinite() && _cellSizeFactors->size() == 0) or
-         _traversalOptions.empty() or _dataLayoutOptions.empty() or _newton3Options.empty();
+         _traversalOptions.empty() or _dataLayoutOptions.empty() or _newton3Options.empty() or
+         (_verletSkins->isFinite() && _verletSkins->size() == 0) or _verletRebuildFrequencies.empty() or
+         _numThreads.empty() or _scheduleOptions.empty() or _scheduleChunkSizes.empty() or
+         _verletClusterSizes.empty();
+}
+
+bool BayesianSearch::setCurrentConfiguration(const Configuration &configuration) {
+  if (not searchSpaceContains(configuration)) {
+    return false;
+  }
+  _currentConfig = configuration;
+  return true;
+}
+
+bool BayesianSearch::searchSpaceContains(const Configuration &configuration) const {
+  return _containerOptions.count(configuration.container) > 0 and
+         _traversalOptions.count(configuration.traversal) > 0 and
+         _dataLayoutOptions.count(configuration.dataLayout) > 0 and _newton3Options.count(configuration.newton3) > 0 and
+         _cellSizeFactors->contains(configuration.cellSizeFactor) and
+         _verletSkins->contains(configuration.verletSkin) and
+         _verletRebuildFrequencies.count(configuration.verletRebuildFrequency) > 0 and
+         _numThreads.count(configuration.numThreads) > 0 and _scheduleOptions.count(configuration.schedule) > 0 and
+         _scheduleChunkSizes.count(configuration.scheduleChunkSize) > 0 and
+         _verletClusterSizes.count(configuration.verletClusterSize) > 0;
 }
 
 void BayesianSearch::removeN3Option(Newton3Option badNewton3Option) {
@@ -0,0 +1,308 @@
+/**
+ * @file CostModel.h
+ * @author F. Gratl
+ * @date 17.10.26
+ */
+
+#pragma once
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+#include "autopas/selectors/Configuration.h"
+#include "autopas/selectors/DomainStatistics.h"
+#include "autopas/utils/ExceptionHandler.h"
+
+namespace autopas {
+
+/**
+ * Analytic estimate of the traversal time of a configuration based on cheap domain statistics.
+ *
+ * The estimate is a weighted sum of features which count the work a configuration has to do per iteration:
+ * - distance checks in the pairwise traversal, separately for AoS and SoA since their cost per check differs,
+ * - pairs of non-empty cells the linked cells traversals process,
+ * - particles that are converted to and from SoA,
+ * - distance checks to rebuild neighbor lists, amortized over the rebuild frequency,
+ * - colors of the traversal, each of which ends in a barrier,
+ * - a constant overhead.
+ * The work is divided by the number of threads that can actually be kept busy by the traversal.
+ *
+ * The weights start at rough values in nanoseconds and are calibrated with every measurement by a least squares fit
+ * of the relative error, regularized towards the default weights so few measurements cannot distort the model.
+ */
+class CostModel {
+ public:
+  /**
+   * Indices of the features in the feature and weight arrays.
+   */
+  enum Feature {
+    aosPairChecks,
+    soaPairChecks,
+    cellPairs,
+    soaConversions,
+    rebuildPairChecks,
+    colors,
+    constant,
+    numFeatures,
+  };
+
+  /**
+   * Features or weights of the model.
+   */
+  using FeatureArray = std::array<double, numFeatures>;
+
+  /**
+   * Constructor.
+   * @param regularization Strength of the pull towards the default weights during calibration. Has to be > 0.
+   */
+  explicit CostModel(double regularization = 0.1) : _regularization(regularization), _weights(getDefaultWeights()) {
+    if (not(regularization > 0.)) {
+      utils::ExceptionHandler::exception("CostModel: Regularization has to be > 0 but is {}", regularization);
+    }
+  }
+
+  /**
+   * Weights that are used before any measurement is available.
+   * @return Weights in nanoseconds per unit of the respective feature.
+   */
+  static FeatureArray getDefaultWeights() { return {8., 2., 20., 10., 4., 2000., 1000.}; }
+
+  /**
+   * Set the statistics of the domain for which the following estimates are made.
+   * @param statistics
+   */
+  void setStatistics(const DomainStatistics &statistics) { _statistics = statistics; }
+
+  /**
+   * Get the statistics of the domain for which estimates are made.
+   * @return
+   */
+  const DomainStatistics &getStatistics() const { return _statistics; }
+
+  /**
+   * Get the current weights of the features.
+   * @return
+   */
+  const FeatureArray &getWeights() const { return _weights; }
+
+  /**
+   * Get the number of measurements the model was calibrated with.
+   * @return
+   */
+  size_t getNumEvidence() const { return _evidenceTimes.size(); }
+
+  /**
+   * Counts the work the given configuration does in the current domain.
+   * @param configuration
+   * @return
+   */
+  FeatureArray getFeatures(const Configuration &configuration) const {
+    FeatureArray features{};
+    features[constant] = 1.;
+    features[colors] = getNumColors(configuration.traversal);
+
+    const double numParticles = _statistics.numParticles;
+    if (numParticles == 0. or _statistics.meanParticlesPerCell <= 0.) {
+      return features;
+    }
+    const double density = _statistics.meanParticlesPerCell / std::pow(_statistics.cutoff, 3);
+    // clustered particles have more neighbors than a homogeneous distribution with the same density
+    const double clustering =
+        std::max(1., 1. + (_statistics.particlesPerCellVariance - _statistics.meanParticlesPerCell) /
+                              (_statistics.meanParticlesPerCell * _statistics.meanParticlesPerCell));
+    const double interactionLength = _statistics.cutoff + configuration.verletSkin;
+    const double interactionSphere = 4. / 3. * M_PI * std::pow(interactionLength, 3) * density * clustering;
+    const double cellLength = configuration.cellSizeFactor * interactionLength;
+    // all particles in the cell stencil around the cell of a particle are checked
+    const double stencilLength = (2. * std::ceil(1. / configuration.cellSizeFactor) + 1.) * cellLength;
+    const double cellStencil = std::pow(stencilLength, 3) * density * clustering;
+    const double numCells = std::max(1., numParticles / (density * std::pow(cellLength, 3)));
+    const double stencilCells = std::pow(2. * std::ceil(1. / configuration.cellSizeFactor) + 1., 3);
+
+    double checksPerParticle = 0.;
+    double rebuildChecksPerParticle = 0.;
+    double cellPairsPerCell = 0.;
+    switch (configuration.container) {
+      case ContainerOption::directSum: {
+        checksPerParticle = numParticles;
+        break;
+      }
+      case ContainerOption::linkedCells: {
+        checksPerParticle = cellStencil;
+        // both cells of a pair have to hold particles for the pair to cause work
+        cellPairsPerCell = stencilCells * _statistics.occupiedCellFraction * _statistics.occupiedCellFraction;
+        break;
+      }
+      case ContainerOption::verletLists:
+      case ContainerOption::verletListsCells:
+      case ContainerOption::varVerletListsAsBuild: {
+        checksPerParticle = interactionSphere;
+        rebuildChecksPerParticle = cellStencil;
+        break;
+      }
+      case ContainerOption::verletClusterLists:
+      case ContainerOption::verletClusterCells: {
+        // whole clusters are checked against each other, which widens the sphere by the extent of a cluster
+        const double clusterSize = std::max(1u, configuration.verletClusterSize);
+        const double clusterLength = std::cbrt(clusterSize / density);
+        checksPerParticle = 4. / 3. * M_PI * std::pow(interactionLength + clusterLength, 3) * density * clustering;
+        rebuildChecksPerParticle = checksPerParticle / clusterSize;
+        break;
+      }
+    }
+
+    if (configuration.newton3 == Newton3Option::enabled) {
+      checksPerParticle *= 0.5;
+      cellPairsPerCell *= 0.5;
+    }
+    const double threads = getNumEffectiveThreads(configuration, numCells);
+    const double pairChecks = numParticles * checksPerParticle / threads;
+    features[cellPairs] = numCells * cellPairsPerCell / threads;
+    if (configuration.dataLayout == DataLayoutOption::aos) {
+      features[aosPairChecks] = pairChecks;
+    } else {
+      features[soaPairChecks] = pairChecks;
+      features[soaConversions] = numParticles / threads;
+    }
+    features[rebuildPairChecks] = numParticles * rebuildChecksPerParticle / getNumThreads(configuration) /
+                                  std::max(1u, configuration.verletRebuildFrequency);
+    return features;
+  }
+
+  /**
+   * Estimates the time one iteration with the given configuration takes in the current domain.
+   * @param configuration
+   * @return Estimated time in nanoseconds.
+   */
+  double estimate(const Configuration &configuration) const {
+    const auto features = getFeatures(configuration);
+    double estimate = 0.;
+    for (size_t i = 0; i < numFeatures; ++i) {
+      estimate += _weights[i] * features[i];
+    }
+    return estimate;
+  }
+
+  /**
+   * Calibrate the weights with a measurement of the given configuration in the current domain.
+   * @param configuration
+   * @param time Measured time in nanoseconds.
+   */
+  void addEvidence(const Configuration &configuration, long time) {
+    if (time <= 0) {
+      return;
+    }
+    _evidenceFeatures.push_back(getFeatures(configuration));
+    _evidenceTimes.push_back(static_cast<double>(time));
+    calibrate();
+  }
+
+  /**
+   * Forget all measurements and return to the default weights.
+   */
+  void clearEvidence() {
+    _evidenceFeatures.clear();
+    _evidenceTimes.clear();
+    _weights = getDefaultWeights();
+  }
+
+  /**
+   * Number of colors or phases between which the threads of a traversal synchronize.
+   * @param traversal
+   * @return
+   */
+  static double getNumColors(TraversalOption traversal) {
+    switch (traversal) {
+      case TraversalOption::c08:
+      case TraversalOption::verletClustersColoring:
+        return 8.;
+      case TraversalOption::c18:
+      case TraversalOption::c18Verlet:
+        return 18.;
+      case TraversalOption::c04:
+      case TraversalOption::c04SoA:
+        return 4.;
+      default:
+        return 1.;
+    }
+  }
+
+ private:
+  /**
+   * Number of threads the configuration runs with.
+   * @param configuration
+   * @return
+   */
+  double getNumThreads(const Configuration &configuration) const {
+    return std::max(1u, configuration.numThreads != 0 ? configuration.numThreads
+                                                      : static_cast<unsigned int>(_statistics.numThreads));
+  }
+
+  /**
+   * Number of threads the pairwise traversal of the configuration can keep busy.
+   * @param configuration
+   * @param numCells Number of cells with the cell size of the configuration.
+   * @return
+   */
+  double getNumEffectiveThreads(const Configuration &configuration, double numCells) const {
+    const double threads = getNumThreads(configuration);
+    switch (configuration.traversal) {
+      case TraversalOption::directSumTraversal:
+        return 1.;
+      case TraversalOption::sliced:
+      case TraversalOption::slicedVerlet:
+        // every slice along the longest dimension needs to be at least two cells thick
+        return std::clamp(std::cbrt(numCells) / 2., 1., threads);
+      default:
+        // colored traversals only find enough work if every color holds enough cells
+        return std::clamp(numCells / getNumColors(configuration.traversal), 1., threads);
+    }
+  }
+
+  /**
+   * Fits the weights to all evidence.
+   *
+   * Minimizes sum_i ((t_i - x_i * w) / t_i)^2 + lambda * sum_j ((w_j - w0_j) / w0_j)^2 so all measurements count the
+   * same independent of their magnitude, and clamps the result to non-negative weights.
+   */
+  void calibrate() {
+    const auto defaultWeights = getDefaultWeights();
+    Eigen::MatrixXd normalMatrix = Eigen::MatrixXd::Zero(numFeatures, numFeatures);
+    Eigen::VectorXd rightHandSide = Eigen::VectorXd::Zero(numFeatures);
+    for (size_t i = 0; i < _evidenceTimes.size(); ++i) {
+      Eigen::VectorXd row(numFeatures);
+      for (size_t j = 0; j < numFeatures; ++j) {
+        row[j] = _evidenceFeatures[i][j] / _evidenceTimes[i];
+      }
+      normalMatrix += row * row.transpose();
+      rightHandSide += row;
+    }
+    for (size_t j = 0; j < numFeatures; ++j) {
+      const double penalty = _regularization / (defaultWeights[j] * defaultWeights[j]);
+      normalMatrix(j, j) += penalty;
+      rightHandSide[j] += penalty * defaultWeights[j];
+    }
+    const Eigen::VectorXd weights = normalMatrix.ldlt().solve(rightHandSide);
+    for (size_t j = 0; j < numFeatures; ++j) {
+      _weights[j] = std::isfinite(weights[j]) ? std::max(0., weights[j]) : defaultWeights[j];
+    }
+  }
+
+  double _regularization;
+  FeatureArray _weights;
+  DomainStatistics _statistics{};
+
+  /**
+   * Features of every measurement, computed with the statistics at the time of the measurement.
+   */
+  std::vector<FeatureArray> _evidenceFeatures;
+  /**
+   * Time of every measurement in nanoseconds.
+   */
+  std::vector<double> _evidenceTimes;
+};
+
+}  // namespace autopas
@@ -0,0 +1,287 @@
+/**
+ * @file CostModelSearch.h
+ * @author F. Gratl
+ * @date 17.10.26
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <set>
+
+#include "CostModel.h"
+#include "TuningStrategyInterface.h"
+#include "autopas/containers/CompatibleTraversals.h"
+#include "autopas/selectors/Configuration.h"
+#include "autopas/utils/ExceptionHandler.h"
+#include "autopas/utils/Logger.h"
+
+namespace autopas {
+
+/**
+ * Tests the configurations in the order of their estimated cost and selects the fastest measured one.
+ *
+ * The estimates come from a CostModel which is calibrated with every measurement, so the order of the remaining
+ * configurations improves while the tuning phase progresses. Measurements of earlier tuning phases are kept in the
+ * model. The phase ends after maxEvidence measurements or when the search space is exhausted.
+ */
+class CostModelSearch : public TuningStrategyInterface {
+ public:
+  /**
+   * Constructor for the CostModelSearch that generates the search space from the allowed options.
+   * @param allowedContainerOptions
+   * @param allowedCellSizeFactors
+   * @param allowedTraversalOptions
+   * @param allowedDataLayoutOptions
+   * @param allowedNewton3Options
+   * @param allowedVerletSkins
+   * @param allowedVerletRebuildFrequencies
+   * @param allowedNumThreads
+   * @param allowedScheduleOptions
+   * @param allowedScheduleChunkSizes
+   * @param allowedVerletClusterSizes
+   * @param maxEvidence Stop tuning after the given number of measurements.
+   */
+  CostModelSearch(const std::set<ContainerOption> &allowedContainerOptions,
+                  const std::set<double> &allowedCellSizeFactors,
+                  const std::set<TraversalOption> &allowedTraversalOptions,
+                  const std::set<DataLayoutOption> &allowedDataLayoutOptions,
+                  const std::set<Newton3Option> &allowedNewton3Options,
+                  const std::set<double> &allowedVerletSkins = {0.},
+                  const std::set<unsigned int> &allowedVerletRebuildFrequencies = {1},
+                  const std::set<unsigned int> &allowedNumThreads = {0},
+                  const std::set<ScheduleOption> &allowedScheduleOptions = {ScheduleOption::dynamicSchedule},
+                  const std::set<unsigned int> &allowedScheduleChunkSizes = {1},
+                  const std::set<unsigned int> &allowedVerletClusterSizes = {4}, size_t maxEvidence = 10)
+      : _containerOptions(allowedContainerOptions), _maxEvidence(maxEvidence) {
+    populateSearchSpace(allowedContainerOptions, allowedCellSizeFactors, allowedTraversalOptions,
+                        allowedDataLayoutOptions, allowedNewton3Options, allowedVerletSkins,
+                        allowedVerletRebuildFrequencies, allowedNumThreads, allowedScheduleOptions,
+                        allowedScheduleChunkSizes, allowedVerletClusterSizes);
+    reset();
+  }
+
+  /**
+   * Constructor for the CostModelSearch that only contains the given configurations.
+   * This constructor assumes only valid configurations are passed! Mainly for easier unit testing.
+   * @param allowedConfigurations Set of configurations AutoPas can choose from.
+   * @param maxEvidence Stop tuning after the given number of measurements.
+   */
+  explicit CostModelSearch(std::set<Configuration> allowedConfigurations, size_t maxEvidence = 10)
+      : _containerOptions{}, _searchSpace(std::move(allowedConfigurations)), _maxEvidence(maxEvidence) {
+    for (const auto &config : _searchSpace) {
+      _containerOptions.insert(config.container);
+    }
+    reset();
+  }
+
+  inline const Configuration &getCurrentConfiguration() const override { return _currentConfig; }
+
+  inline bool setCurrentConfiguration(const Configuration &configuration) override {
+    if (not searchSpaceContains(configuration)) {
+      return false;
+    }
+    _currentConfig = configuration;
+    return true;
+  }
+
+  inline bool searchSpaceContains(const Configuration &configuration) const override {
+    return _searchSpace.count(configuration) > 0;
+  }
+
+  inline void removeN3Option(Newton3Option badNewton3Option) override;
+
+  inline void addEvidence(long time) override {
+    _costModel.addEvidence(_currentConfig, time);
+    auto [iter, inserted] = _evidence.emplace(_currentConfig, time);
+    if (not inserted) {
+      iter->second = std::min(iter->second, time);
+    }
+  }
+
+  inline void reset() override {
+    _evidence.clear();
+    _untested = _searchSpace;
+    selectCheapestUntested();
+  }
+
+  inline bool tune(bool currentInvalid = false) override;
+
+  inline std::set<ContainerOption> getAllowedContainerOptions() const override { return _containerOptions; }
+
+  inline bool searchSpaceIsTrivial() const override { return _searchSpace.size() == 1; }
+
+  inline bool searchSpaceIsEmpty() const override { return _searchSpace.empty(); }
+
+  inline void setDomainStatistics(const DomainStatistics &statistics) override {
+    _costModel.setStatistics(statistics);
+  }
+
+  /**
+   * Get the cost model that ranks the configurations.
+   * @return
+   */
+  const CostModel &getCostModel() const { return _costModel; }
+
+ private:
+  /**
+   * Fills the search space with the cartesian product of the given options (minus invalid combinations).
+   * @param allowedContainerOptions
+   * @param allowedCellSizeFactors
+   * @param allowedTraversalOptions
+   * @param allowedDataLayoutOptions
+   * @param allowedNewton3Options
+   * @param allowedVerletSkins
+   * @param allowedVerletRebuildFrequencies
+   * @param allowedNumThreads
+   * @param allowedScheduleOptions
+   * @param allowedScheduleChunkSizes
+   * @param allowedVerletClusterSizes
+   */
+  inline void populateSearchSpace(const std::set<ContainerOption> &allowedContainerOptions,
+                                  const std::set<double> &allowedCellSizeFactors,
+                                  const std::set<TraversalOption> &allowedTraversalOptions,
+                                  const std::set<DataLayoutOption> &allowedDataLayoutOptions,
+                                  const std::set<Newton3Option> &allowedNewton3Options,
+                                  const std::set<double> &allowedVerletSkins,
+                                  const std::set<unsigned int> &allowedVerletRebuildFrequencies,
+                                  const std::set<unsigned int> &allowedNumThreads,
+                                  const std::set<ScheduleOption> &allowedScheduleOptions,
+                                  const std::set<unsigned int> &allowedScheduleChunkSizes,
+                                  const std::set<unsigned int> &allowedVerletClusterSizes);
+
+  /**
+   * Sets the current configuration to the untested one with the smallest estimated cost.
+   */
+  inline void selectCheapestUntested() {
+    auto cheapest = std::min_element(_untested.begin(), _untested.end(), [&](const auto &a, const auto &b) {
+      return _costModel.estimate(a) < _costModel.estimate(b);
+    });
+    if (cheapest != _untested.end()) {
+      _currentConfig = *cheapest;
+    }
+  }
+
+  std::set<ContainerOption> _containerOptions;
+  std::set<Configuration> _searchSpace;
+  size_t _maxEvidence;
+  CostModel _costModel;
+
+  /**
+   * Configurations that were not tested in the current tuning phase.
+   */
+  std::set<Configuration> _untested;
+  /**
+   * Smallest evidence per configuration in the current tuning phase.
+   */
+  std::map<Configuration, long> _evidence;
+  Configuration _currentConfig;
+};
+
+void CostModelSearch::populateSearchSpace(const std::set<ContainerOption> &allowedContainerOptions,
+                                          const std::set<double> &allowedCellSizeFactors,
+                                          const std::set<TraversalOption> &allowedTraversalOptions,
+                                          const std::set<DataLayoutOption> &allowedDataLayoutOptions,
+                                          const std::set<Newton3Option> &allowedNewton3Options,
+                                          const std::set<double> &allowedVerletSkins,
+                                          const std::set<unsigned int> &allowedVerletRebuildFrequencies,
+                                          const std::set<unsigned int> &allowedNumThreads,
+                                          const std::set<ScheduleOption> &allowedScheduleOptions,
+                                          const std::set<unsigned int> &allowedScheduleChunkSizes,
+                                          const std::set<unsigned int> &allowedVerletClusterSizes) {
+  for (auto &containerOption : allowedContainerOptions) {
+    // get all traversals of the container and restrict them to the allowed ones
+    const std::set<TraversalOption> &allContainerTraversals =
+        compatibleTraversals::allCompatibleTraversals(containerOption);
+    std::set<TraversalOption> allowedAndApplicable;
+    std::set_intersection(allowedTraversalOptions.begin(), allowedTraversalOptions.end(),
+                          allContainerTraversals.begin(), allContainerTraversals.end(),
+                          std::inserter(allowedAndApplicable, allowedAndApplicable.begin()));
+    // the cluster size only makes a difference for the cluster containers
+    const bool isClusterContainer = containerOption == ContainerOption::verletClusterLists or
+                                    containerOption == ContainerOption::verletClusterCells;
+    const std::set<unsigned int> clusterSizes = isClusterContainer or allowedVerletClusterSizes.empty()
+                                                    ? allowedVerletClusterSizes
+                                                    : std::set<unsigned int>{*allowedVerletClusterSizes.begin()};
+
+    for (auto &cellSizeFactor : allowedCellSizeFactors) {
+      for (auto &traversalOption : allowedAndApplicable) {
+        for (auto &dataLayoutOption : allowedDataLayoutOptions) {
+          for (auto &newton3Option : allowedNewton3Options) {
+            for (auto &verletSkin : allowedVerletSkins) {
+              for (auto &verletRebuildFrequency : allowedVerletRebuildFrequencies) {
+                for (auto &numThreads : allowedNumThreads) {
+                  for (auto &scheduleOption : allowedScheduleOptions) {
+                    for (auto &scheduleChunkSize : allowedScheduleChunkSizes) {
+                      for (auto &verletClusterSize : clusterSizes) {
+                        _searchSpace.emplace(containerOption, cellSizeFactor, traversalOption, dataLayoutOption,
+                                             newton3Option, verletSkin, verletRebuildFrequency, numThreads,
+                                             scheduleOption, scheduleChunkSize, verletClusterSize);
+                      }
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  AutoPasLog(debug, "Points in search space: {}", _searchSpace.size());
+
+  if (_searchSpace.empty()) {
+    autopas::utils::ExceptionHandler::exception("CostModelSearch: No valid configurations could be created.");
+  }
+}
+
+bool CostModelSearch::tune(bool currentInvalid) {
+  if (currentInvalid) {
+    _evidence.erase(_currentConfig);
+  }
+  _untested.erase(_currentConfig);
+
+  if (_evidence.size() < _maxEvidence and not _untested.empty()) {
+    // the model was calibrated with the last measurement, so the ranking of the remaining configurations is updated
+    selectCheapestUntested();
+    return true;
+  }
+
+  if (_evidence.empty()) {
+    utils::ExceptionHandler::exception(
+        "CostModelSearch: Trying to determine fastest configuration without any measurements! "
+        "Either tune was called too early or no applicable configurations were found");
+  }
+
+  _currentConfig = std::min_element(_evidence.begin(), _evidence.end(), [](const auto &a, const auto &b) {
+                     return a.second < b.second;
+                   })->first;
+  AutoPasLog(debug, "Selected Configuration {} after {} measurements", _currentConfig.toString(), _evidence.size());
+  return false;
+}
+
+void CostModelSearch::removeN3Option(Newton3Option badNewton3Option) {
+  for (auto ssIter = _searchSpace.begin(); ssIter != _searchSpace.end();) {
+    if (ssIter->newton3 == badNewton3Option) {
+      _untested.erase(*ssIter);
+      _evidence.erase(*ssIter);
+      ssIter = _searchSpace.erase(ssIter);
+    } else {
+      ++ssIter;
+    }
+  }
+
+  if (this->searchSpaceIsEmpty()) {
+    utils::ExceptionHandler::exception(
+        "Removing all configurations with Newton 3 {} caused the search space to be empty!", badNewton3Option);
+  }
+
+  if (_currentConfig.newton3 == badNewton3Option) {
+    selectCheapestUntested();
+  }
+}
+
+}  // namespace autopas
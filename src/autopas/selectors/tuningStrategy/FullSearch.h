@@ -28,15 +28,28 @@ class FullSearch : public TuningStrategyInterface {
    * @param allowedDataLayoutOptions
    * @param allowedNewton3Options
    * @param allowedCellSizeFactors
+   * @param allowedVerletSkins
+   * @param allowedVerletRebuildFrequencies
+   * @param allowedNumThreads
+   * @param allowedScheduleOptions
+   * @param allowedScheduleChunkSizes
+   * @param allowedVerletClusterSizes
    */
   FullSearch(const std::set<ContainerOption> &allowedContainerOptions, const std::set<double> &allowedCellSizeFactors,
              const std::set<TraversalOption> &allowedTraversalOptions,
              const std::set<DataLayoutOption> &allowedDataLayoutOptions,
-             const std::set<Newton3Option> &allowedNewton3Options)
+             const std::set<Newton3Option> &allowedNewton3Options, const std::set<double> &allowedVerletSkins = {0.},
+             const std::set<unsigned int> &allowedVerletRebuildFrequencies = {1},
+             const std::set<unsigned int> &allowedNumThreads = {0},
+             const std::set<ScheduleOption> &allowedScheduleOptions = {ScheduleOption::dynamicSchedule},
+             const std::set<unsigned int> &allowedScheduleChunkSizes = {1},
+             const std::set<unsigned int> &allowedVerletClusterSizes = {4})
       : _containerOptions(allowedContainerOptions) {
     // sets search space and current config
     populateSearchSpace(allowedContainerOptions, allowedCellSizeFactors, allowedTraversalOptions,
-                        allowedDataLayoutOptions, allowedNewton3Options);
+                        allowedDataLayoutOptions, allowedNewton3Options, allowedVerletSkins,
+                        allowedVerletRebuildFrequencies, allowedNumThreads, allowedScheduleOptions,
+                        allowedScheduleChunkSizes, allowedVerletClusterSizes);
   }
 
   /**
@@ -53,6 +66,12 @@ class FullSearch : public TuningStrategyInterface {
 
   inline const Configuration &getCurrentConfiguration() const override { return *_currentConfig; }
 
+  inline bool setCurrentConfiguration(const Configuration &configuration) override;
+
+  inline bool searchSpaceContains(const Configuration &configuration) const override {
+    return _searchSpace.count(configuration) > 0;
+  }
+
   inline void removeN3Option(Newton3Option badNewton3Option) override;
 
   inline void addEvidence(long time) override { _traversalTimes[*_currentConfig] = time; }
@@ -77,12 +96,24 @@ class FullSearch : public TuningStrategyInterface {
    * @param allowedTraversalOptions
    * @param allowedDataLayoutOptions
    * @param allowedNewton3Options
+   * @param allowedVerletSkins
+   * @param allowedVerletRebuildFrequencies
+   * @param allowedNumThreads
+   * @param allowedScheduleOptions
+   * @param allowedScheduleChunkSizes
+   * @param allowedVerletClusterSizes
    */
   inline void populateSearchSpace(const std::set<ContainerOption> &allowedContainerOptions,
                                   const std::set<double> &allowedCellSizeFactors,
                                   const std::set<TraversalOption> &allowedTraversalOptions,
                                   const std::set<DataLayoutOption> &allowedDataLayoutOptions,
-                                  const std::set<Newton3Option> &allowedNewton3Options);
+                                  const std::set<Newton3Option> &allowedNewton3Options,
+                                  const std::set<double> &allowedVerletSkins,
+                                  const std::set<unsigned int> &allowedVerletRebuildFrequencies,
+                                  const std::set<unsigned int> &allowedNumThreads,
+                                  const std::set<ScheduleOption> &allowedScheduleOptions,
+                                  const std::set<unsigned int> &allowedScheduleChunkSizes,
+                                  const std::set<unsigned int> &allowedVerletClusterSizes);
 
   inline void selectOptimalConfiguration();
 
@@ -96,7 +127,13 @@ void FullSearch::populateSearchSpace(const std::set<ContainerOption> &allowedCon
                                      const std::set<double> &allowedCellSizeFactors,
                                      const std::set<TraversalOption> &allowedTraversalOptions,
                                      const std::set<DataLayoutOption> &allowedDataLayoutOptions,
-                                     const std::set<Newton3Option> &allowedNewton3Options) {
+                                     const std::set<Newton3Option> &allowedNewton3Options,
+                                     const std::set<double> &allowedVerletSkins,
+                                     const std::set<unsigned int> &allowedVerletRebuildFrequencies,
+                                     const std::set<unsigned int> &allowedNumThreads,
+                                     const std::set<ScheduleOption> &allowedScheduleOptions,
+                                     const std::set<unsigned int> &allowedScheduleChunkSizes,
+                                     const std::set<unsigned int> &allowedVerletClusterSizes) {
   // generate all potential configs
   for (auto &containerOption : allowedContainerOptions) {
     // get all traversals of the container and restrict them to the allowed ones
@@ -106,12 +143,32 @@ void FullSearch::populateSearchSpace(const std::set<ContainerOption> &allowedCon
     std::set_intersection(allowedTraversalOptions.begin(), allowedTraversalOptions.end(),
                           allContainerTraversals.begin(), allContainerTraversals.end(),
                           std::inserter(allowedAndApplicable, allowedAndApplicable.begin()));
+    // the cluster size only makes a difference for the cluster containers
+    const bool isClusterContainer = containerOption == ContainerOption::verletClusterLists or
+                                    containerOption == ContainerOption::verletClusterCells;
+    const std::set<unsigned int> clusterSizes = isClusterContainer or allowedVerletClusterSizes.empty()
+                                                    ? allowedVerletClusterSizes
+                                                    : std::set<unsigned int>{*allowedVerletClusterSizes.begin()};
 
     for (auto &cellSizeFactor : allowedCellSizeFactors)
       for (auto &traversalOption : allowedAndApplicable) {
         for (auto &dataLayoutOption : allowedDataLayoutOptions) {
           for (auto &newton3Option : allowedNewton3Options) {
-            _searchSpace.emplace(containerOption, cellSizeFactor, traversalOption, dataLayoutOption, newton3Option);
+            for (auto &verletSkin : allowedVerletSkins) {
+              for (auto &verletRebuildFrequency : allowedVerletRebuildFrequencies) {
+                for (auto &numThreads : allowedNumThreads) {
+                  for (auto &scheduleOption : allowedScheduleOptions) {
+                    for (auto &scheduleChunkSize : allowedScheduleChunkSizes) {
+                      for (auto &verletClusterSize : clusterSizes) {
+                        _searchSpace.emplace(containerOption, cellSizeFactor, traversalOption, dataLayoutOption,
+                                             newton3Option, verletSkin, verletRebuildFrequency, numThreads,
+                                             scheduleOption, scheduleChunkSize, verletClusterSize);
+                      }
+                    }
+                  }
+                }
+              }
+            }
           }
         }
       }
@@ -168,6 +225,15 @@ void FullSearch::selectOptimalConfiguration() {
   AutoPasLog(debug, "Selected Configuration {}", _currentConfig->toString());
 }
 
+bool FullSearch::setCurrentConfiguration(const Configuration &configuration) {
+  auto configIter = _searchSpace.find(configuration);
+  if (configIter == _searchSpace.end()) {
+    return false;
+  }
+  _currentConfig = configIter;
+  return true;
+}
+
 void FullSearch::removeN3Option(Newton3Option badNewton3Option) {
   for (auto ssIter = _searchSpace.begin(); ssIter != _searchSpace.end();) {
     if (ssIter->newton3 == badNewton3Option) {
@@ -7,6 +7,10 @@
 #pragma once
 
 #include <Eigen/Dense>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <vector>
 
 #include "autopas/options/AcquisitionFunctionOption.h"
 #include "autopas/utils/ExceptionHandler.h"
@@ -55,9 +59,9 @@ class GaussianProcess {
     Eigen::VectorXd dimScales;
 
     /**
-     * Covariance Matrix Inverse
+     * Lower triangular Cholesky factor L of the covariance matrix C = L * L^T
      */
-    Eigen::MatrixXd covMatInv;
+    Eigen::MatrixXd covMatL;
     /**
      * Weights used for predictions
      */
@@ -70,7 +74,7 @@ class GaussianProcess {
         : mean(0.),
           theta(1.),
           dimScales(Eigen::VectorXd::Ones(1)),
-          covMatInv(Eigen::MatrixXd::Ones(1, 1)),
+          covMatL(Eigen::MatrixXd::Ones(1, 1)),
           weights(Eigen::VectorXd::Ones(1)) {}
 
     /**
@@ -103,15 +107,65 @@ class GaussianProcess {
       }
 
       // cholesky decomposition
-      Eigen::LLT<Eigen::MatrixXd> llt = covMat.llt();
-      Eigen::MatrixXd l = llt.matrixL();
+      covMatL = covMat.llt().matrixL();
 
-      // precalculate inverse of covMat and weights for predictions
-      covMatInv = llt.solve(Eigen::MatrixXd::Identity(size, size));
-      weights = covMatInv * outputCentered;
+      calculateWeightsAndScore(outputCentered);
+    }
+
+    /**
+     * Update the precalculated matrices after the last element of inputs and outputs was added.
+     *
+     * The Cholesky factor is extended by one row in O(n^2) instead of factorizing the whole covariance matrix again.
+     * Falls back to precalculate() if the matrices do not belong to the previous evidence or the update is numerically
+     * unstable.
+     *
+     * @param sigma assumed noise
+     * @param inputs evidence input
+     * @param outputs evidence output
+     */
+    void appendEvidence(double sigma, const std::vector<Vector> &inputs, const Eigen::VectorXd &outputs) {
+      const long size = outputs.size();
+      const long oldSize = size - 1;
+      if (covMatL.rows() != oldSize or oldSize == 0) {
+        precalculate(sigma, inputs, outputs);
+        return;
+      }
+
+      Eigen::VectorXd kVec(oldSize);
+      for (long i = 0; i < oldSize; ++i) {
+        kVec[i] = kernel(inputs[i], inputs.back(), theta, dimScales);
+      }
+      // new row of L: L * l = kVec and l^2 + lastDiag^2 = k(x, x) + sigma
+      Eigen::VectorXd newRow = covMatL.triangularView<Eigen::Lower>().solve(kVec);
+      const double lastDiagSquared =
+          kernel(inputs.back(), inputs.back(), theta, dimScales) + sigma - newRow.squaredNorm();
+      if (not(lastDiagSquared > 0.)) {
+        precalculate(sigma, inputs, outputs);
+        return;
+      }
+
+      covMatL.conservativeResize(size, size);
+      covMatL.block(oldSize, 0, 1, oldSize) = newRow.transpose();
+      covMatL.block(0, oldSize, oldSize, 1).setZero();
+      covMatL(oldSize, oldSize) = std::sqrt(lastDiagSquared);
+
+      calculateWeightsAndScore(outputs - mean * Eigen::VectorXd::Ones(size));
+    }
+
+   private:
+    /**
+     * Calculate weights and score from covMatL without forming the inverse of the covariance matrix.
+     * @param outputCentered evidence output shifted by the prior mean
+     */
+    void calculateWeightsAndScore(const Eigen::VectorXd &outputCentered) {
+      // weights = C^-1 * y = L^-T * (L^-1 * y)
+      weights = covMatL.triangularView<Eigen::Lower>().solve(outputCentered);
+      // y^T * C^-1 * y = |L^-1 * y|^2
+      const double squaredNorm = weights.squaredNorm();
+      covMatL.triangularView<Eigen::Lower>().transpose().solveInPlace(weights);
 
       // likelihood of evidence given parameters
-      score = std::exp(-0.5 * outputCentered.dot(weights)) / l.diagonal().prod();
+      score = std::exp(-0.5 * squaredNorm) / covMatL.diagonal().prod();
 
       if (std::isnan(score)) {
         // error score calculation failed
@@ -135,6 +189,18 @@ class GaussianProcess {
    */
   void clear() { _inputs.clear(); }
 
+  /**
+   * Set a function that predicts f(x) before any evidence is known, e.g. from a cost model.
+   *
+   * The process then only models the difference between the evidence and this prior. Since the evidence is stored
+   * relative to the prior, all evidence is discarded.
+   * @param priorMeanFunction Prior prediction of f(x). An empty function stands for a prior of zero.
+   */
+  void setPriorMean(std::function<double(const Vector &)> priorMeanFunction) {
+    _priorMean = std::move(priorMeanFunction);
+    clear();
+  }
+
   /**
    * Get the number of evidence provided.
    * @return
@@ -171,7 +237,7 @@ class GaussianProcess {
 
     // extend output vector
     _outputs.conservativeResize(newSize, Eigen::NoChange_t());
-    _outputs(newSize - 1) = output;
+    _outputs(newSize - 1) = output - priorMean(input);
 
     updateHyperparameters();
   }
@@ -214,9 +280,9 @@ class GaussianProcess {
     }
 
     // default mean 0.
-    if (_inputs.size() == 0) return 0.;
+    if (_inputs.size() == 0) return priorMean(input);
 
-    double result = 0.;
+    double result = priorMean(input);
     for (auto &hyper : _hypers) {
       result += hyper.score * (hyper.mean + kernelVector(input, hyper.theta, hyper.dimScales).dot(hyper.weights));
     }
@@ -241,8 +307,10 @@ class GaussianProcess {
 
     double result = 0.;
     for (auto &hyper : _hypers) {
+      // k^T * C^-1 * k = |L^-1 * k|^2
       Eigen::VectorXd kVec = kernelVector(input, hyper.theta, hyper.dimScales);
-      result += hyper.score * (kernel(input, input, hyper.theta, hyper.dimScales) - kVec.dot(hyper.covMatInv * kVec));
+      hyper.covMatL.template triangularView<Eigen::Lower>().solveInPlace(kVec);
+      result += hyper.score * (kernel(input, input, hyper.theta, hyper.dimScales) - kVec.squaredNorm());
     }
     return result;
   }
@@ -293,20 +361,8 @@ class GaussianProcess {
    * @return
    */
   Vector sampleAquisitionMax(AcquisitionFunctionOption af, const std::vector<Vector> &samples) const {
-    int maxIdx = -1;
-    double maxVal = 0.;
-
-    // find maximum from samples
-    for (unsigned i = 0; i < samples.size(); ++i) {
-      double val = calcAcquisition(af, samples[i]);
-
-      if (maxIdx == -1 || val > maxVal) {
-        maxIdx = i;
-        maxVal = val;
-      }
-    }
-
-    return samples[maxIdx];
+    auto values = calcAcquisitions(af, samples);
+    return samples[std::distance(values.begin(), std::max_element(values.begin(), values.end()))];
   }
 
   /**
@@ -317,23 +373,29 @@ class GaussianProcess {
    * @return
    */
   Vector sampleAquisitionMin(AcquisitionFunctionOption af, const std::vector<Vector> &samples) const {
-    int minIdx = -1;
-    double minVal = 0.;
-
-    // find minimum from samples
-    for (unsigned i = 0; i < samples.size(); ++i) {
-      double val = calcAcquisition(af, samples[i]);
+    auto values = calcAcquisitions(af, samples);
+    return samples[std::distance(values.begin(), std::min_element(values.begin(), values.end()))];
+  }
 
-      if (minIdx == -1 || val < minVal) {
-        minIdx = i;
-        minVal = val;
-      }
+ private:
+  /**
+   * Calculates the acquisition function for all samples in parallel.
+   * @param af acquisition function
+   * @param samples
+   * @return acquisition values in the order of samples
+   */
+  std::vector<double> calcAcquisitions(AcquisitionFunctionOption af, const std::vector<Vector> &samples) const {
+    std::vector<double> values(samples.size());
+    // every evaluation iterates over all hyperparameters, which is expensive enough to split samples among threads
+#ifdef AUTOPAS_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (size_t i = 0; i < samples.size(); ++i) {
+      values[i] = calcAcquisition(af, samples[i]);
     }
-
-    return samples[minIdx];
+    return values;
   }
 
- private:
   /**
    * Update the hyperparameters: theta, dimScale.
    * To do so, hyperparameter-samples are randomly generated.
@@ -344,6 +406,8 @@ class GaussianProcess {
   inline void updateHyperparameters() {
     // number of evidence
     size_t newSize = _inputs.size();
+    // the best hyperparameters so far stay candidates and can be updated cheaply with the new evidence
+    auto previousHypers = std::move(_hypers);
     _hypers.clear();
 
     // if no evidence
@@ -357,15 +421,16 @@ class GaussianProcess {
       _hypers.emplace_back(_outputs[0], _outputs[0] * _outputs[0], Eigen::VectorXd::Ones(_dims));
       _hypers[0].precalculate(_sigma, _inputs, _outputs);
     } else {
+      // the process models the outputs relative to the prior mean
+      const double outputMin = _outputs.minCoeff();
+      const double outputMax = _outputs.maxCoeff();
       // range of mean
       // inside bounds of evidence outputs
-      NumberInterval<double> meanRange(_evidenceMinValue, _evidenceMaxValue);
+      NumberInterval<double> meanRange(outputMin, outputMax);
       // range of theta
       // max sample stddev: (max - min)
       // max stddev from zero: abs(min) & abs(max)
-      double thetaMax = std::pow(
-          std::max({_evidenceMaxValue - _evidenceMinValue, std::abs(_evidenceMinValue), std::abs(_evidenceMaxValue)}),
-          2);
+      double thetaMax = std::pow(std::max({outputMax - outputMin, std::abs(outputMin), std::abs(outputMax)}), 2);
       // at least sigma
       thetaMax = std::max(thetaMax, _sigma);
       NumberInterval<double> thetaRange(_sigma, thetaMax);
@@ -399,7 +464,7 @@ class GaussianProcess {
       }
 
       // initialize hyperparameter samples
-      _hypers.reserve(hp_sample_size);
+      _hypers.reserve(hp_sample_size + previousHypers.size());
       for (size_t t = 0; t < hp_sample_size; ++t) {
         _hypers.emplace_back(sample_means[t], sample_thetas[t], sample_dimScales[t]);
       }
@@ -407,13 +472,24 @@ class GaussianProcess {
       // precalculate matrices for all hyperparameters
       // @TODO find sensible chunkSize
 #ifdef AUTOPAS_OPENMP
-      const size_t chunkSize = std::max(hp_sample_size / (autopas_get_num_threads() * 10), 1ul);
+      const size_t chunkSize = std::max(hp_sample_size / (autopas_get_max_threads() * 10), 1ul);
 #pragma omp parallel for schedule(dynamic, chunkSize)
 #endif
       for (size_t t = 0; t < hp_sample_size; ++t) {
         _hypers[t].precalculate(_sigma, _inputs, _outputs);
       }
 
+      // previous hyperparameters only need their Cholesky factor extended
+      for (auto &hyper : previousHypers) {
+        _hypers.push_back(std::move(hyper));
+      }
+#ifdef AUTOPAS_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+      for (size_t t = hp_sample_size; t < _hypers.size(); ++t) {
+        _hypers[t].appendEvidence(_sigma, _inputs, _outputs);
+      }
+
       // sort by score
       std::sort(_hypers.begin(), _hypers.end(),
                 [](const Hyperparameters &h1, const Hyperparameters &h2) { return h1.score > h2.score; });
@@ -452,6 +528,13 @@ class GaussianProcess {
     return theta * std::exp(-dot);
   }
 
+  /**
+   * Evaluates the prior mean.
+   * @param input
+   * @return prior prediction of f(input)
+   */
+  double priorMean(const Vector &input) const { return _priorMean ? _priorMean(input) : 0.; }
+
   /**
    * Calculates the kernel between input and all evidence.
    * @param input
@@ -466,7 +549,11 @@ class GaussianProcess {
   }
 
   std::vector<Vector> _inputs;
+  /**
+   * Evidence outputs relative to the prior mean.
+   */
   Eigen::VectorXd _outputs;
+  std::function<double(const Vector &)> _priorMean;
 
   /**
    * Current smallest evidence output
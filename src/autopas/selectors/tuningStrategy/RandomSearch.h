@@ -27,6 +27,12 @@ class RandomSearch : public TuningStrategyInterface {
    * @param allowedDataLayoutOptions
    * @param allowedNewton3Options
    * @param allowedCellSizeFactors
+   * @param allowedVerletSkins
+   * @param allowedVerletRebuildFrequencies
+   * @param allowedNumThreads
+   * @param allowedScheduleOptions
+   * @param allowedScheduleChunkSizes
+   * @param allowedVerletClusterSizes
    * @param maxEvidence stop tuning after given number of evidence provided.
    * @param seed seed of random number generator (should only be used for tests)
    */
@@ -35,12 +41,24 @@ class RandomSearch : public TuningStrategyInterface {
                const std::set<TraversalOption> &allowedTraversalOptions = TraversalOption::getAllOptions(),
                const std::set<DataLayoutOption> &allowedDataLayoutOptions = DataLayoutOption::getAllOptions(),
                const std::set<Newton3Option> &allowedNewton3Options = Newton3Option::getAllOptions(),
-               size_t maxEvidence = 10, unsigned long seed = std::random_device()())
+               const NumberSet<double> &allowedVerletSkins = NumberSetFinite<double>({0.}),
+               const std::set<unsigned int> &allowedVerletRebuildFrequencies = {1},
+               const std::set<unsigned int> &allowedNumThreads = {0},
+               const std::set<ScheduleOption> &allowedScheduleOptions = {ScheduleOption::dynamicSchedule},
+               const std::set<unsigned int> &allowedScheduleChunkSizes = {1},
+               const std::set<unsigned int> &allowedVerletClusterSizes = {4}, size_t maxEvidence = 10,
+               unsigned long seed = std::random_device()())
       : _containerOptions(allowedContainerOptions),
         _traversalOptions(allowedTraversalOptions),
         _dataLayoutOptions(allowedDataLayoutOptions),
         _newton3Options(allowedNewton3Options),
         _cellSizeFactors(allowedCellSizeFactors.clone()),
+        _verletSkins(allowedVerletSkins.clone()),
+        _verletRebuildFrequencies(allowedVerletRebuildFrequencies),
+        _numThreads(allowedNumThreads),
+        _scheduleOptions(allowedScheduleOptions),
+        _scheduleChunkSizes(allowedScheduleChunkSizes),
+        _verletClusterSizes(allowedVerletClusterSizes),
         _currentConfig(),
         _rng(seed),
         _maxEvidence(maxEvidence) {
@@ -49,6 +67,10 @@ class RandomSearch : public TuningStrategyInterface {
 
   inline const Configuration &getCurrentConfiguration() const override { return _currentConfig; }
 
+  inline bool setCurrentConfiguration(const Configuration &configuration) override;
+
+  inline bool searchSpaceContains(const Configuration &configuration) const override;
+
   inline void removeN3Option(Newton3Option badNewton3Option) override;
 
   inline void addEvidence(long time) override { _traversalTimes[_currentConfig] = time; }
@@ -74,6 +96,12 @@ class RandomSearch : public TuningStrategyInterface {
   std::set<DataLayoutOption> _dataLayoutOptions;
   std::set<Newton3Option> _newton3Options;
   std::unique_ptr<NumberSet<double>> _cellSizeFactors;
+  std::unique_ptr<NumberSet<double>> _verletSkins;
+  std::set<unsigned int> _verletRebuildFrequencies;
+  std::set<unsigned int> _numThreads;
+  std::set<ScheduleOption> _scheduleOptions;
+  std::set<unsigned int> _scheduleChunkSizes;
+  std::set<unsigned int> _verletClusterSizes;
 
   Configuration _currentConfig;
   std::unordered_map<Configuration, size_t, ConfigHash> _traversalTimes;
@@ -101,6 +129,12 @@ bool RandomSearch::tune(bool) {
   _currentConfig.traversal = _rng.pickRandom(_traversalOptions);
   _currentConfig.dataLayout = _rng.pickRandom(_dataLayoutOptions);
   _currentConfig.newton3 = _rng.pickRandom(_newton3Options);
+  _currentConfig.verletSkin = _verletSkins->getRandom(_rng);
+  _currentConfig.verletRebuildFrequency = _rng.pickRandom(_verletRebuildFrequencies);
+  _currentConfig.numThreads = _rng.pickRandom(_numThreads);
+  _currentConfig.schedule = _rng.pickRandom(_scheduleOptions);
+  _currentConfig.scheduleChunkSize = _rng.pickRandom(_scheduleChunkSizes);
+  _currentConfig.verletClusterSize = _rng.pickRandom(_verletClusterSizes);
   return true;
 }
 
@@ -111,6 +145,12 @@ void RandomSearch::selectOptimalConfiguration() {
     _currentConfig.traversal = *_traversalOptions.begin();
     _currentConfig.dataLayout = *_dataLayoutOptions.begin();
     _currentConfig.newton3 = *_newton3Options.begin();
+    _currentConfig.verletSkin = _verletSkins->getMin();
+    _currentConfig.verletRebuildFrequency = *_verletRebuildFrequencies.begin();
+    _currentConfig.numThreads = *_numThreads.begin();
+    _currentConfig.schedule = *_scheduleOptions.begin();
+    _currentConfig.scheduleChunkSize = *_scheduleChunkSizes.begin();
+    _currentConfig.verletClusterSize = *_verletClusterSizes.begin();
     return;
   }
 
@@ -140,13 +180,39 @@ bool RandomSearch::searchSpaceIsTrivial() const {
   }
 
   return _containerOptions.size() == 1 and (_cellSizeFactors->isFinite() && _cellSizeFactors->size() == 1) and
-         _traversalOptions.size() == 1 and _dataLayoutOptions.size() == 1 and _newton3Options.size() == 1;
+         _traversalOptions.size() == 1 and _dataLayoutOptions.size() == 1 and _newton3Options.size() == 1 and
+         (_verletSkins->isFinite() && _verletSkins->size() == 1) and _verletRebuildFrequencies.size() == 1 and
+         _numThreads.size() == 1 and _scheduleOptions.size() == 1 and _scheduleChunkSizes.size() == 1 and
+         _verletClusterSizes.size() == 1;
 }
 
 bool RandomSearch::searchSpaceIsEmpty() const {
   // if one enum is empty return true
   return _containerOptions.empty() or (_cellSizeFactors->isFinite() && _cellSizeFactors->size() == 0) or
-         _traversalOptions.empty() or _dataLayoutOptions.empty() or _newton3Options.empty();
+         _traversalOptions.empty() or _dataLayoutOptions.empty() or _newton3Options.empty() or
+         (_verletSkins->isFinite() && _verletSkins->size() == 0) or _verletRebuildFrequencies.empty() or
+         _numThreads.empty() or _scheduleOptions.empty() or _scheduleChunkSizes.empty() or
+         _verletClusterSizes.empty();
+}
+
+bool RandomSearch::setCurrentConfiguration(const Configuration &configuration) {
+  if (not searchSpaceContains(configuration)) {
+    return false;
+  }
+  _currentConfig = configuration;
+  return true;
+}
+
+bool RandomSearch::searchSpaceContains(const Configuration &configuration) const {
+  return _containerOptions.count(configuration.container) > 0 and
+         _traversalOptions.count(configuration.traversal) > 0 and
+         _dataLayoutOptions.count(configuration.dataLayout) > 0 and _newton3Options.count(configuration.newton3) > 0 and
+         _cellSizeFactors->contains(configuration.cellSizeFactor) and
+         _verletSkins->contains(configuration.verletSkin) and
+         _verletRebuildFrequencies.count(configuration.verletRebuildFrequency) > 0 and
+         _numThreads.count(configuration.numThreads) > 0 and _scheduleOptions.count(configuration.schedule) > 0 and
+         _scheduleChunkSizes.count(configuration.scheduleChunkSize) > 0 and
+         _verletClusterSizes.count(configuration.verletClusterSize) > 0;
 }
 
 void RandomSearch::removeN3Option(Newton3Option badNewton3Option) {
@@ -0,0 +1,333 @@
+/**
+ * @file SuccessiveHalving.h
+ * @author F. Gratl
+ * @date 16.10.26
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <map>
+#include <set>
+#include <vector>
+
+#include "TuningStrategyInterface.h"
+#include "autopas/containers/CompatibleTraversals.h"
+#include "autopas/selectors/Configuration.h"
+#include "autopas/utils/ExceptionHandler.h"
+#include "autopas/utils/Logger.h"
+
+namespace autopas {
+
+/**
+ * Successive halving over the search space.
+ *
+ * In the first round every configuration is tested once. After each round only the fastest 1/reductionFactor of the
+ * configurations are kept and tested again, until one configuration remains. Configurations are ranked by the mean of
+ * all their evidence so the survivors get more accurate estimates the longer they stay in the race.
+ * With a reduction factor of two the whole phase costs less than two rounds over the full search space.
+ */
+class SuccessiveHalving : public TuningStrategyInterface {
+ public:
+  /**
+   * Constructor for the SuccessiveHalving that generates the search space from the allowed options.
+   * @param allowedContainerOptions
+   * @param allowedCellSizeFactors
+   * @param allowedTraversalOptions
+   * @param allowedDataLayoutOptions
+   * @param allowedNewton3Options
+   * @param allowedVerletSkins
+   * @param allowedVerletRebuildFrequencies
+   * @param allowedNumThreads
+   * @param allowedScheduleOptions
+   * @param allowedScheduleChunkSizes
+   * @param allowedVerletClusterSizes
+   * @param reductionFactor Only the fastest 1/reductionFactor configurations survive a round. Has to be > 1.
+   */
+  SuccessiveHalving(const std::set<ContainerOption> &allowedContainerOptions,
+                    const std::set<double> &allowedCellSizeFactors,
+                    const std::set<TraversalOption> &allowedTraversalOptions,
+                    const std::set<DataLayoutOption> &allowedDataLayoutOptions,
+                    const std::set<Newton3Option> &allowedNewton3Options,
+                    const std::set<double> &allowedVerletSkins = {0.},
+                    const std::set<unsigned int> &allowedVerletRebuildFrequencies = {1},
+                    const std::set<unsigned int> &allowedNumThreads = {0},
+                    const std::set<ScheduleOption> &allowedScheduleOptions = {ScheduleOption::dynamicSchedule},
+                    const std::set<unsigned int> &allowedScheduleChunkSizes = {1},
+                    const std::set<unsigned int> &allowedVerletClusterSizes = {4}, double reductionFactor = 2.)
+      : _containerOptions(allowedContainerOptions), _reductionFactor(reductionFactor) {
+    checkReductionFactor();
+    populateSearchSpace(allowedContainerOptions, allowedCellSizeFactors, allowedTraversalOptions,
+                        allowedDataLayoutOptions, allowedNewton3Options, allowedVerletSkins,
+                        allowedVerletRebuildFrequencies, allowedNumThreads, allowedScheduleOptions,
+                        allowedScheduleChunkSizes, allowedVerletClusterSizes);
+    reset();
+  }
+
+  /**
+   * Constructor for the SuccessiveHalving that only contains the given configurations.
+   * This constructor assumes only valid configurations are passed! Mainly for easier unit testing.
+   * @param allowedConfigurations Set of configurations AutoPas can choose from.
+   * @param reductionFactor Only the fastest 1/reductionFactor configurations survive a round. Has to be > 1.
+   */
+  explicit SuccessiveHalving(std::set<Configuration> allowedConfigurations, double reductionFactor = 2.)
+      : _containerOptions{}, _searchSpace(std::move(allowedConfigurations)), _reductionFactor(reductionFactor) {
+    checkReductionFactor();
+    for (const auto &config : _searchSpace) {
+      _containerOptions.insert(config.container);
+    }
+    reset();
+  }
+
+  inline const Configuration &getCurrentConfiguration() const override { return _currentConfig; }
+
+  inline bool setCurrentConfiguration(const Configuration &configuration) override {
+    if (not searchSpaceContains(configuration)) {
+      return false;
+    }
+    _currentConfig = configuration;
+    return true;
+  }
+
+  inline bool searchSpaceContains(const Configuration &configuration) const override {
+    return _searchSpace.count(configuration) > 0;
+  }
+
+  inline void removeN3Option(Newton3Option badNewton3Option) override;
+
+  inline void addEvidence(long time) override {
+    auto &[sum, count] = _evidence[_currentConfig];
+    sum += static_cast<double>(time);
+    ++count;
+  }
+
+  inline void reset() override {
+    _evidence.clear();
+    _candidates.assign(_searchSpace.begin(), _searchSpace.end());
+    _currentIndex = 0;
+    _round = 0;
+    if (not _candidates.empty()) {
+      _currentConfig = _candidates.front();
+    }
+  }
+
+  inline bool tune(bool currentInvalid = false) override;
+
+  inline std::set<ContainerOption> getAllowedContainerOptions() const override { return _containerOptions; }
+
+  inline bool searchSpaceIsTrivial() const override { return _searchSpace.size() == 1; }
+
+  inline bool searchSpaceIsEmpty() const override { return _searchSpace.empty(); }
+
+ private:
+  /**
+   * Fills the search space with the cartesian product of the given options (minus invalid combinations).
+   * @param allowedContainerOptions
+   * @param allowedCellSizeFactors
+   * @param allowedTraversalOptions
+   * @param allowedDataLayoutOptions
+   * @param allowedNewton3Options
+   * @param allowedVerletSkins
+   * @param allowedVerletRebuildFrequencies
+   * @param allowedNumThreads
+   * @param allowedScheduleOptions
+   * @param allowedScheduleChunkSizes
+   * @param allowedVerletClusterSizes
+   */
+  inline void populateSearchSpace(const std::set<ContainerOption> &allowedContainerOptions,
+                                  const std::set<double> &allowedCellSizeFactors,
+                                  const std::set<TraversalOption> &allowedTraversalOptions,
+                                  const std::set<DataLayoutOption> &allowedDataLayoutOptions,
+                                  const std::set<Newton3Option> &allowedNewton3Options,
+                                  const std::set<double> &allowedVerletSkins,
+                                  const std::set<unsigned int> &allowedVerletRebuildFrequencies,
+                                  const std::set<unsigned int> &allowedNumThreads,
+                                  const std::set<ScheduleOption> &allowedScheduleOptions,
+                                  const std::set<unsigned int> &allowedScheduleChunkSizes,
+                                  const std::set<unsigned int> &allowedVerletClusterSizes);
+
+  inline void checkReductionFactor() const {
+    if (not(_reductionFactor > 1.)) {
+      utils::ExceptionHandler::exception("SuccessiveHalving: Reduction factor has to be > 1 but is {}",
+                                         _reductionFactor);
+    }
+  }
+
+  /**
+   * Drops the slow candidates at the end of a round and starts the next one.
+   * @return false iff only one candidate is left, which is then selected as optimum.
+   */
+  inline bool finishRound();
+
+  std::set<ContainerOption> _containerOptions;
+  std::set<Configuration> _searchSpace;
+  double _reductionFactor;
+
+  /**
+   * Configurations that are still in the race.
+   */
+  std::vector<Configuration> _candidates;
+  /**
+   * Position of the current configuration in _candidates.
+   */
+  size_t _currentIndex{0};
+  /**
+   * Number of finished rounds in the current tuning phase.
+   */
+  size_t _round{0};
+  Configuration _currentConfig;
+  /**
+   * Sum and number of all evidence per configuration in the current tuning phase.
+   */
+  std::map<Configuration, std::pair<double, size_t>> _evidence;
+};
+
+void SuccessiveHalving::populateSearchSpace(const std::set<ContainerOption> &allowedContainerOptions,
+                                            const std::set<double> &allowedCellSizeFactors,
+                                            const std::set<TraversalOption> &allowedTraversalOptions,
+                                            const std::set<DataLayoutOption> &allowedDataLayoutOptions,
+                                            const std::set<Newton3Option> &allowedNewton3Options,
+                                            const std::set<double> &allowedVerletSkins,
+                                            const std::set<unsigned int> &allowedVerletRebuildFrequencies,
+                                            const std::set<unsigned int> &allowedNumThreads,
+                                            const std::set<ScheduleOption> &allowedScheduleOptions,
+                                            const std::set<unsigned int> &allowedScheduleChunkSizes,
+                                            const std::set<unsigned int> &allowedVerletClusterSizes) {
+  for (auto &containerOption : allowedContainerOptions) {
+    // get all traversals of the container and restrict them to the allowed ones
+    const std::set<TraversalOption> &allContainerTraversals =
+        compatibleTraversals::allCompatibleTraversals(containerOption);
+    std::set<TraversalOption> allowedAndApplicable;
+    std::set_intersection(allowedTraversalOptions.begin(), allowedTraversalOptions.end(),
+                          allContainerTraversals.begin(), allContainerTraversals.end(),
+                          std::inserter(allowedAndApplicable, allowedAndApplicable.begin()));
+    // the cluster size only makes a difference for the cluster containers
+    const bool isClusterContainer = containerOption == ContainerOption::verletClusterLists or
+                                    containerOption == ContainerOption::verletClusterCells;
+    const std::set<unsigned int> clusterSizes = isClusterContainer or allowedVerletClusterSizes.empty()
+                                                    ? allowedVerletClusterSizes
+                                                    : std::set<unsigned int>{*allowedVerletClusterSizes.begin()};
+
+    for (auto &cellSizeFactor : allowedCellSizeFactors) {
+      for (auto &traversalOption : allowedAndApplicable) {
+        for (auto &dataLayoutOption : allowedDataLayoutOptions) {
+          for (auto &newton3Option : allowedNewton3Options) {
+            for (auto &verletSkin : allowedVerletSkins) {
+              for (auto &verletRebuildFrequency : allowedVerletRebuildFrequencies) {
+                for (auto &numThreads : allowedNumThreads) {
+                  for (auto &scheduleOption : allowedScheduleOptions) {
+                    for (auto &scheduleChunkSize : allowedScheduleChunkSizes) {
+                      for (auto &verletClusterSize : clusterSizes) {
+                        _searchSpace.emplace(containerOption, cellSizeFactor, traversalOption, dataLayoutOption,
+                                             newton3Option, verletSkin, verletRebuildFrequency, numThreads,
+                                             scheduleOption, scheduleChunkSize, verletClusterSize);
+                      }
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  AutoPasLog(debug, "Points in search space: {}", _searchSpace.size());
+
+  if (_searchSpace.empty()) {
+    autopas::utils::ExceptionHandler::exception("SuccessiveHalving: No valid configurations could be created.");
+  }
+}
+
+bool SuccessiveHalving::tune(bool currentInvalid) {
+  if (currentInvalid) {
+    // invalid configurations do not take part in later rounds. The next candidate moves to _currentIndex.
+    _evidence.erase(_currentConfig);
+    _candidates.erase(_candidates.begin() + _currentIndex);
+  } else {
+    ++_currentIndex;
+  }
+
+  if (_currentIndex < _candidates.size()) {
+    _currentConfig = _candidates[_currentIndex];
+    return true;
+  }
+
+  return finishRound();
+}
+
+bool SuccessiveHalving::finishRound() {
+  // only configurations that were actually measured stay in the race
+  _candidates.erase(std::remove_if(_candidates.begin(), _candidates.end(),
+                                   [&](const Configuration &config) { return _evidence.count(config) == 0; }),
+                    _candidates.end());
+
+  if (_candidates.empty()) {
+    utils::ExceptionHandler::exception(
+        "SuccessiveHalving: Trying to determine fastest configuration without any measurements! "
+        "Either tune was called too early or no applicable configurations were found");
+  }
+
+  auto meanTime = [&](const Configuration &config) {
+    const auto &[sum, count] = _evidence.at(config);
+    return sum / count;
+  };
+  std::stable_sort(_candidates.begin(), _candidates.end(),
+                   [&](const Configuration &a, const Configuration &b) { return meanTime(a) < meanTime(b); });
+
+  const auto numSurvivors = std::max(
+      size_t{1}, static_cast<size_t>(std::ceil(static_cast<double>(_candidates.size()) / _reductionFactor)));
+  _candidates.resize(std::min(numSurvivors, _candidates.size()));
+  ++_round;
+  _currentIndex = 0;
+  _currentConfig = _candidates.front();
+
+  if (_candidates.size() == 1) {
+    AutoPasLog(debug, "Selected Configuration {} after {} rounds", _currentConfig.toString(), _round);
+    return false;
+  }
+
+  AutoPasLog(debug, "SuccessiveHalving: {} configurations left after round {}", _candidates.size(), _round);
+  return true;
+}
+
+void SuccessiveHalving::removeN3Option(Newton3Option badNewton3Option) {
+  for (auto ssIter = _searchSpace.begin(); ssIter != _searchSpace.end();) {
+    if (ssIter->newton3 == badNewton3Option) {
+      ssIter = _searchSpace.erase(ssIter);
+    } else {
+      ++ssIter;
+    }
+  }
+
+  if (this->searchSpaceIsEmpty()) {
+    utils::ExceptionHandler::exception(
+        "Removing all configurations with Newton 3 {} caused the search space to be empty!", badNewton3Option);
+  }
+
+  // remove the configurations from the current round. Candidates before the current one are already measured.
+  size_t removedBeforeCurrent = 0;
+  for (size_t i = 0; i < _currentIndex and i < _candidates.size(); ++i) {
+    if (_candidates[i].newton3 == badNewton3Option) {
+      ++removedBeforeCurrent;
+    }
+  }
+  _candidates.erase(std::remove_if(_candidates.begin(), _candidates.end(),
+                                   [&](const Configuration &config) { return config.newton3 == badNewton3Option; }),
+                    _candidates.end());
+  _currentIndex -= removedBeforeCurrent;
+
+  if (_currentIndex < _candidates.size()) {
+    _currentConfig = _candidates[_currentIndex];
+  } else if (_evidence.empty()) {
+    // nothing measured yet so start over with what is left
+    reset();
+  } else {
+    finishRound();
+  }
+}
+
+}  // namespace autopas
@@ -7,6 +7,8 @@
 #pragma once
 
 #include "autopas/selectors/Configuration.h"
+#include "autopas/selectors/DomainStatistics.h"
+#include "autopas/utils/PerformanceCounters.h"
 
 namespace autopas {
 
@@ -23,12 +25,40 @@ class TuningStrategyInterface {
    */
   virtual void addEvidence(long time) = 0;
 
+  /**
+   * Store hardware performance counters measured for the current configuration. If counters are enabled and available,
+   * this is called right before addEvidence() with the counts summed over all samples that make up the evidence.
+   *
+   * They tell e.g. memory bound (low IPC, many cache misses) from compute bound configurations. Strategies that do not
+   * model this ignore it, which is the default.
+   * @param values
+   */
+  virtual void addPerformanceCounterEvidence(const utils::PerformanceCounterValues &values) {}
+
   /**
    * Returns the currently selected configuration object.
    * @return
    */
   virtual const Configuration &getCurrentConfiguration() const = 0;
 
+  /**
+   * Sets the current configuration to the given one if it is part of the search space.
+   *
+   * This can be used to skip a tuning phase, e.g. if the optimum is already known from a previous run.
+   * The next call to reset() starts a regular tuning phase again.
+   *
+   * @param configuration
+   * @return true iff the configuration is part of the search space and was selected.
+   */
+  virtual bool setCurrentConfiguration(const Configuration &configuration) = 0;
+
+  /**
+   * Checks whether the given configuration is part of the search space.
+   * @param configuration
+   * @return
+   */
+  virtual bool searchSpaceContains(const Configuration &configuration) const = 0;
+
   /**
    * Selects the next configuration to test or the optimum.
    *
@@ -71,5 +101,13 @@ class TuningStrategyInterface {
    * @return
    */
   virtual bool searchSpaceIsEmpty() const = 0;
+
+  /**
+   * Informs the strategy about the domain the next tuning phase tunes for. Called before reset().
+   *
+   * Only strategies that model the cost of configurations need this, so the default ignores it.
+   * @param statistics
+   */
+  virtual void setDomainStatistics(const DomainStatistics &statistics) {}
 };
 }  // namespace autopas
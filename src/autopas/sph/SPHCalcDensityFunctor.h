@@ -177,6 +177,67 @@ class SPHCalcDensityFunctor : public Functor<Particle, ParticleCell, typename Pa
   void SoAFunctor(SoAView<SoAArraysType> soa,
                   const std::vector<std::vector<size_t, autopas::AlignedAllocator<size_t>>> &neighborList, size_t iFrom,
                   size_t iTo, bool newton3) override {
+    SoAFunctorVerletImpl(soa, neighborList, iFrom, iTo, newton3);
+  }
+
+  // clang-format off
+  /**
+   * @copydoc Functor::SoAFunctor(SoAView<SoAArraysType>, const CSRNeighborLists<size_t> &, size_t, size_t, bool)
+   */
+  // clang-format on
+  void SoAFunctor(SoAView<SoAArraysType> soa, const CSRNeighborLists<size_t> &neighborList, size_t iFrom, size_t iTo,
+                  bool newton3) override {
+    SoAFunctorVerletImpl(soa, neighborList, iFrom, iTo, newton3);
+  }
+
+  // clang-format off
+  /**
+   * @copydoc Functor::SoAFunctor(SoAView<SoAArraysType>, const CSRNeighborLists<uint32_t> &, size_t, size_t, bool)
+   */
+  // clang-format on
+  void SoAFunctor(SoAView<SoAArraysType> soa, const CSRNeighborLists<uint32_t> &neighborList, size_t iFrom,
+                  size_t iTo, bool newton3) override {
+    SoAFunctorVerletImpl(soa, neighborList, iFrom, iTo, newton3);
+  }
+
+  /**
+   * @copydoc Functor::getNeededAttr()
+   */
+  constexpr static const std::array<typename SPHParticle::AttributeNames, 6> getNeededAttr() {
+    return std::array<typename Particle::AttributeNames, 6>{
+        Particle::AttributeNames::mass, Particle::AttributeNames::posX, Particle::AttributeNames::posY,
+        Particle::AttributeNames::posZ, Particle::AttributeNames::smth, Particle::AttributeNames::density};
+  }
+
+  /**
+   * @copydoc Functor::getNeededAttr(std::false_type)
+   */
+  constexpr static const std::array<typename SPHParticle::AttributeNames, 5> getNeededAttr(std::false_type) {
+    return std::array<typename Particle::AttributeNames, 5>{
+        Particle::AttributeNames::mass, Particle::AttributeNames::posX, Particle::AttributeNames::posY,
+        Particle::AttributeNames::posZ, Particle::AttributeNames::smth};
+  }
+
+  /**
+   * @copydoc Functor::getComputedAttr()
+   */
+  constexpr static const std::array<typename SPHParticle::AttributeNames, 1> getComputedAttr() {
+    return std::array<typename Particle::AttributeNames, 1>{Particle::AttributeNames::density};
+  }
+
+ private:
+  /**
+   * Implementation of the verlet SoAFunctor.
+   * @tparam NeighborListsType Either a vector of neighbor lists or CSRNeighborLists.
+   * @param soa
+   * @param neighborList
+   * @param iFrom
+   * @param iTo
+   * @param newton3
+   */
+  template <class NeighborListsType>
+  void SoAFunctorVerletImpl(SoAView<SoAArraysType> &soa, const NeighborListsType &neighborList, size_t iFrom,
+                            size_t iTo, bool newton3) {
     if (soa.getNumParticles() == 0) return;
 
     double *const __restrict__ xptr = soa.template begin<Particle::AttributeNames::posX>();
@@ -189,7 +250,7 @@ class SPHCalcDensityFunctor : public Functor<Particle, ParticleCell, typename Pa
 
     for (unsigned int i = iFrom; i < iTo; ++i) {
       double densacc = 0;
-      auto &currentList = neighborList[i];
+      const auto &currentList = neighborList[i];
       size_t listSize = currentList.size();
 // icpc vectorizes this.
 // g++ only with -ffast-math or -funsafe-math-optimizations
@@ -218,31 +279,6 @@ class SPHCalcDensityFunctor : public Functor<Particle, ParticleCell, typename Pa
       densityptr[i] += densacc;
     }
   }
-
-  /**
-   * @copydoc Functor::getNeededAttr()
-   */
-  constexpr static const std::array<typename SPHParticle::AttributeNames, 6> getNeededAttr() {
-    return std::array<typename Particle::AttributeNames, 6>{
-        Particle::AttributeNames::mass, Particle::AttributeNames::posX, Particle::AttributeNames::posY,
-        Particle::AttributeNames::posZ, Particle::AttributeNames::smth, Particle::AttributeNames::density};
-  }
-
-  /**
-   * @copydoc Functor::getNeededAttr(std::false_type)
-   */
-  constexpr static const std::array<typename SPHParticle::AttributeNames, 5> getNeededAttr(std::false_type) {
-    return std::array<typename Particle::AttributeNames, 5>{
-        Particle::AttributeNames::mass, Particle::AttributeNames::posX, Particle::AttributeNames::posY,
-        Particle::AttributeNames::posZ, Particle::AttributeNames::smth};
-  }
-
-  /**
-   * @copydoc Functor::getComputedAttr()
-   */
-  constexpr static const std::array<typename SPHParticle::AttributeNames, 1> getComputedAttr() {
-    return std::array<typename Particle::AttributeNames, 1>{Particle::AttributeNames::density};
-  }
 };
 }  // namespace sph
 }  // namespace autopas
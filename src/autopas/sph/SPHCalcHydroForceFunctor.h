@@ -357,6 +357,90 @@ class SPHCalcHydroForceFunctor : public Functor<SPHParticle, FullParticleCell<SP
   void SoAFunctor(SoAView<SoAArraysType> soa,
                   const std::vector<std::vector<size_t, autopas::AlignedAllocator<size_t>>> &neighborList, size_t iFrom,
                   size_t iTo, bool newton3) override {
+    SoAFunctorVerletImpl(soa, neighborList, iFrom, iTo, newton3);
+  }
+
+  // clang-format off
+  /**
+   * @copydoc Functor::SoAFunctor(SoAView<SoAArraysType>, const CSRNeighborLists<size_t> &, size_t, size_t, bool)
+   */
+  // clang-format on
+  void SoAFunctor(SoAView<SoAArraysType> soa, const CSRNeighborLists<size_t> &neighborList, size_t iFrom, size_t iTo,
+                  bool newton3) override {
+    SoAFunctorVerletImpl(soa, neighborList, iFrom, iTo, newton3);
+  }
+
+  // clang-format off
+  /**
+   * @copydoc Functor::SoAFunctor(SoAView<SoAArraysType>, const CSRNeighborLists<uint32_t> &, size_t, size_t, bool)
+   */
+  // clang-format on
+  void SoAFunctor(SoAView<SoAArraysType> soa, const CSRNeighborLists<uint32_t> &neighborList, size_t iFrom,
+                  size_t iTo, bool newton3) override {
+    SoAFunctorVerletImpl(soa, neighborList, iFrom, iTo, newton3);
+  }
+
+  /**
+   * @copydoc Functor::getNeededAttr()
+   */
+  constexpr static const std::array<typename SPHParticle::AttributeNames, 16> getNeededAttr() {
+    ///@todo distinguish between N3 and notN3
+    return std::array<typename SPHParticle::AttributeNames, 16>{
+        SPHParticle::AttributeNames::mass,     SPHParticle::AttributeNames::density,
+        SPHParticle::AttributeNames::smth,     SPHParticle::AttributeNames::soundSpeed,
+        SPHParticle::AttributeNames::pressure, SPHParticle::AttributeNames::vsigmax,
+        SPHParticle::AttributeNames::engDot,   SPHParticle::AttributeNames::posX,
+        SPHParticle::AttributeNames::posY,     SPHParticle::AttributeNames::posZ,
+        SPHParticle::AttributeNames::velX,     SPHParticle::AttributeNames::velY,
+        SPHParticle::AttributeNames::velZ,     SPHParticle::AttributeNames::accX,
+        SPHParticle::AttributeNames::accY,     SPHParticle::AttributeNames::accZ};
+  }
+
+  /**
+   * @copydoc Functor::getNeededAttr(std::false_type)
+   */
+  constexpr static const std::array<typename SPHParticle::AttributeNames, 11> getNeededAttr(std::false_type) {
+    ///@todo distinguish between N3 and notN3
+    return std::array<typename SPHParticle::AttributeNames, 11>{
+        SPHParticle::AttributeNames::mass,     SPHParticle::AttributeNames::density,
+        SPHParticle::AttributeNames::smth,     SPHParticle::AttributeNames::soundSpeed,
+        SPHParticle::AttributeNames::pressure, SPHParticle::AttributeNames::posX,
+        SPHParticle::AttributeNames::posY,     SPHParticle::AttributeNames::posZ,
+        SPHParticle::AttributeNames::velX,     SPHParticle::AttributeNames::velY,
+        SPHParticle::AttributeNames::velZ};
+  }
+
+  /**
+   * @copydoc Functor::getComputedAttr()
+   */
+  constexpr static const std::array<typename sph::SPHParticle::AttributeNames, 5> getComputedAttr() {
+    return std::array<typename SPHParticle::AttributeNames, 5>{
+        SPHParticle::AttributeNames::vsigmax, SPHParticle::AttributeNames::engDot, SPHParticle::AttributeNames::accX,
+        SPHParticle::AttributeNames::accY, SPHParticle::AttributeNames::accZ};
+  }
+
+  /**
+   * Get the number of floating point operations used in one full kernel call
+   * @return the number of floating point operations
+   */
+  static unsigned long getNumFlopsPerKernelCall() {
+    ///@todo return correct flopcount
+    return 1ul;
+  }
+
+ private:
+  /**
+   * Implementation of the verlet SoAFunctor.
+   * @tparam NeighborListsType Either a vector of neighbor lists or CSRNeighborLists.
+   * @param soa
+   * @param neighborList
+   * @param iFrom
+   * @param iTo
+   * @param newton3
+   */
+  template <class NeighborListsType>
+  void SoAFunctorVerletImpl(SoAView<SoAArraysType> &soa, const NeighborListsType &neighborList, size_t iFrom,
+                            size_t iTo, bool newton3) {
     if (soa.getNumParticles() == 0) return;
 
     double *const __restrict__ massptr = soa.template begin<autopas::sph::SPHParticle::AttributeNames::mass>();
@@ -385,7 +469,7 @@ class SPHCalcHydroForceFunctor : public Functor<SPHParticle, FullParticleCell<SP
       double localAccY = 0.;
       double localAccZ = 0.;
 
-      auto &currentList = neighborList[i];
+      const auto &currentList = neighborList[i];
       size_t listSize = currentList.size();
 
       // icpc vectorizes this.
@@ -471,54 +555,6 @@ class SPHCalcHydroForceFunctor : public Functor<SPHParticle, FullParticleCell<SP
       vsigmaxptr[i] = std::max(localvsigmax, vsigmaxptr[i]);
     }
   }
-
-  /**
-   * @copydoc Functor::getNeededAttr()
-   */
-  constexpr static const std::array<typename SPHParticle::AttributeNames, 16> getNeededAttr() {
-    ///@todo distinguish between N3 and notN3
-    return std::array<typename SPHParticle::AttributeNames, 16>{
-        SPHParticle::AttributeNames::mass,     SPHParticle::AttributeNames::density,
-        SPHParticle::AttributeNames::smth,     SPHParticle::AttributeNames::soundSpeed,
-        SPHParticle::AttributeNames::pressure, SPHParticle::AttributeNames::vsigmax,
-        SPHParticle::AttributeNames::engDot,   SPHParticle::AttributeNames::posX,
-        SPHParticle::AttributeNames::posY,     SPHParticle::AttributeNames::posZ,
-        SPHParticle::AttributeNames::velX,     SPHParticle::AttributeNames::velY,
-        SPHParticle::AttributeNames::velZ,     SPHParticle::AttributeNames::accX,
-        SPHParticle::AttributeNames::accY,     SPHParticle::AttributeNames::accZ};
-  }
-
-  /**
-   * @copydoc Functor::getNeededAttr(std::false_type)
-   */
-  constexpr static const std::array<typename SPHParticle::AttributeNames, 11> getNeededAttr(std::false_type) {
-    ///@todo distinguish between N3 and notN3
-    return std::array<typename SPHParticle::AttributeNames, 11>{
-        SPHParticle::AttributeNames::mass,     SPHParticle::AttributeNames::density,
-        SPHParticle::AttributeNames::smth,     SPHParticle::AttributeNames::soundSpeed,
-        SPHParticle::AttributeNames::pressure, SPHParticle::AttributeNames::posX,
-        SPHParticle::AttributeNames::posY,     SPHParticle::AttributeNames::posZ,
-        SPHParticle::AttributeNames::velX,     SPHParticle::AttributeNames::velY,
-        SPHParticle::AttributeNames::velZ};
-  }
-
-  /**
-   * @copydoc Functor::getComputedAttr()
-   */
-  constexpr static const std::array<typename sph::SPHParticle::AttributeNames, 5> getComputedAttr() {
-    return std::array<typename SPHParticle::AttributeNames, 5>{
-        SPHParticle::AttributeNames::vsigmax, SPHParticle::AttributeNames::engDot, SPHParticle::AttributeNames::accX,
-        SPHParticle::AttributeNames::accY, SPHParticle::AttributeNames::accZ};
-  }
-
-  /**
-   * Get the number of floating point operations used in one full kernel call
-   * @return the number of floating point operations
-   */
-  static unsigned long getNumFlopsPerKernelCall() {
-    ///@todo return correct flopcount
-    return 1ul;
-  }
 };
 
 }  // namespace sph
@@ -0,0 +1,171 @@
+/**
+ * @file CSRNeighborLists.h
+ * @author F. Gratl
+ * @date 17.10.26
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "autopas/utils/AlignedAllocator.h"
+
+namespace autopas {
+
+/**
+ * Neighbor lists of all particles in compressed sparse row format.
+ *
+ * The neighbors of all particles are stored back to back in one aligned array. The neighbors of particle i are the
+ * entries from offsets[i] to offsets[i + 1]. Compared to one vector per particle this needs two allocations instead of
+ * one per particle and the lists of consecutive particles are adjacent in memory.
+ *
+ * Lists are either appended one after the other via addNeighbor() and finishList(), or all at once by calling
+ * setListSizes() followed by writing to getList().
+ *
+ * @tparam IndexType Type of the neighbor indices.
+ */
+template <class IndexType = size_t>
+class CSRNeighborLists {
+ public:
+  /**
+   * Read only view on the neighbors of one particle.
+   * Provides the parts of the std::vector interface the functors use.
+   */
+  class ListView {
+   public:
+    /**
+     * Constructor.
+     * @param data Pointer to the first neighbor.
+     * @param size Number of neighbors.
+     */
+    ListView(const IndexType *data, size_t size) : _data(data), _size(size) {}
+
+    /**
+     * Pointer to the first neighbor.
+     * @return
+     */
+    const IndexType *data() const { return _data; }
+
+    /**
+     * Number of neighbors.
+     * @return
+     */
+    size_t size() const { return _size; }
+
+    /**
+     * Indicates whether there are no neighbors.
+     * @return
+     */
+    bool empty() const { return _size == 0; }
+
+    /**
+     * Index of the n-th neighbor.
+     * @param n
+     * @return
+     */
+    IndexType operator[](size_t n) const { return _data[n]; }
+
+    /**
+     * Iterator to the first neighbor.
+     * @return
+     */
+    const IndexType *begin() const { return _data; }
+
+    /**
+     * Iterator behind the last neighbor.
+     * @return
+     */
+    const IndexType *end() const { return _data + _size; }
+
+   private:
+    const IndexType *_data;
+    size_t _size;
+  };
+
+  /**
+   * Constructor. Creates zero lists.
+   */
+  CSRNeighborLists() : _offsets{0}, _neighbors{} {}
+
+  /**
+   * Number of lists, i.e. of particles.
+   * @return
+   */
+  size_t size() const { return _offsets.size() - 1; }
+
+  /**
+   * Total number of neighbors in all lists.
+   * @return
+   */
+  size_t getNumNeighbors() const { return _neighbors.size(); }
+
+  /**
+   * Get the neighbors of particle i.
+   * @param i
+   * @return
+   */
+  ListView operator[](size_t i) const { return {_neighbors.data() + _offsets[i], _offsets[i + 1] - _offsets[i]}; }
+
+  /**
+   * Remove all lists but keep the allocated memory.
+   */
+  void clear() {
+    _offsets.resize(1);
+    _neighbors.clear();
+  }
+
+  /**
+   * Reserve memory.
+   * @param numLists Expected number of lists.
+   * @param numNeighbors Expected total number of neighbors.
+   */
+  void reserve(size_t numLists, size_t numNeighbors) {
+    _offsets.reserve(numLists + 1);
+    _neighbors.reserve(numNeighbors);
+  }
+
+  /**
+   * Append a neighbor to the list that is currently built.
+   * @param neighbor
+   */
+  void addNeighbor(IndexType neighbor) { _neighbors.push_back(neighbor); }
+
+  /**
+   * Finish the list that is currently built. The next neighbor will belong to the next particle.
+   */
+  void finishList() { _offsets.push_back(_neighbors.size()); }
+
+  /**
+   * Replace all lists by lists of the given sizes. Their content is undefined until it is written via getList().
+   * @param listSizes Number of neighbors of every particle.
+   */
+  void setListSizes(const std::vector<size_t> &listSizes) {
+    _offsets.resize(listSizes.size() + 1);
+    _offsets[0] = 0;
+    for (size_t i = 0; i < listSizes.size(); ++i) {
+      _offsets[i + 1] = _offsets[i] + listSizes[i];
+    }
+    _neighbors.resize(_offsets.back());
+  }
+
+  /**
+   * Get writable access to the neighbors of particle i.
+   * @param i
+   * @return Pointer to the first of the neighbors.
+   */
+  IndexType *getList(size_t i) { return _neighbors.data() + _offsets[i]; }
+
+ private:
+  /**
+   * Begin of the list of every particle in _neighbors, followed by the total number of neighbors.
+   */
+  std::vector<size_t> _offsets;
+
+  /**
+   * Neighbors of all particles.
+   */
+  std::vector<IndexType, AlignedAllocator<IndexType>> _neighbors;
+};
+
+}  // namespace autopas
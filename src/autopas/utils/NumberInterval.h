@@ -65,6 +65,8 @@ class NumberInterval : public NumberSet<Number> {
     return {};
   }
 
+  inline bool contains(Number number) const override { return _min <= number and number <= _max; }
+
   inline Number getRandom(Random &rng) const override {
     std::uniform_real_distribution<Number> distr(_min, _max);
     return distr(rng);
@@ -84,6 +84,13 @@ class NumberSet {
    */
   virtual std::set<Number> getAll() const = 0;
 
+  /**
+   * Indicates if the given number is part of the set.
+   * @param number
+   * @return True if number is in the set
+   */
+  virtual bool contains(Number number) const = 0;
+
   /**
    * Get a random number in the set.
    * @param rng random number generator
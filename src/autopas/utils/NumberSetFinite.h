@@ -48,6 +48,8 @@ class NumberSetFinite : public NumberSet<Number> {
 
   inline std::set<Number> getAll() const override { return _set; }
 
+  inline bool contains(Number number) const override { return _set.find(number) != _set.end(); }
+
   inline Number getRandom(Random &rng) const override { return rng.pickRandom(_set); }
   std::vector<Number> uniformSample(size_t n, Random &rng) const override { return rng.uniformSample(_set, n); }
 };
@@ -0,0 +1,384 @@
+/**
+ * @file PerformanceCounters.h
+ * @author F. Gratl
+ * @date 17.10.26
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#if defined(__x86_64__)
+#include <cpuid.h>
+#endif
+
+#include "autopas/utils/Logger.h"
+#include "autopas/utils/WrapOpenMP.h"
+
+namespace autopas::utils {
+
+/**
+ * Hardware event counts of one or more measured code regions, summed over all threads.
+ */
+struct PerformanceCounterValues {
+  /**
+   * Core cycles.
+   */
+  double cycles{0.};
+  /**
+   * Retired instructions.
+   */
+  double instructions{0.};
+  /**
+   * Accesses to the last level cache.
+   */
+  double llcReferences{0.};
+  /**
+   * Misses in the last level cache.
+   */
+  double llcMisses{0.};
+  /**
+   * Double precision floating point operations, counting every lane of vector instructions.
+   */
+  double flops{0.};
+  /**
+   * Whether the processor provides the events for flops.
+   */
+  bool hasFlops{false};
+  /**
+   * Number of measured regions the counts are summed over.
+   */
+  size_t numMeasurements{0};
+
+  /**
+   * Instructions per cycle.
+   * @return
+   */
+  double getIPC() const { return cycles > 0. ? instructions / cycles : 0.; }
+
+  /**
+   * Fraction of the last level cache accesses that miss.
+   * @return
+   */
+  double getLLCMissRate() const { return llcReferences > 0. ? llcMisses / llcReferences : 0.; }
+
+  /**
+   * Last level cache misses per thousand instructions.
+   * @return
+   */
+  double getLLCMissesPerKiloInstruction() const { return instructions > 0. ? 1000. * llcMisses / instructions : 0.; }
+
+  /**
+   * Flops per cycle. A high value combined with few cache misses hints at a compute bound configuration.
+   * @return
+   */
+  double getFlopsPerCycle() const { return cycles > 0. ? flops / cycles : 0.; }
+
+  /**
+   * Add the counts of another measurement.
+   * @param other
+   * @return
+   */
+  PerformanceCounterValues &operator+=(const PerformanceCounterValues &other) {
+    cycles += other.cycles;
+    instructions += other.instructions;
+    llcReferences += other.llcReferences;
+    llcMisses += other.llcMisses;
+    flops += other.flops;
+    hasFlops = hasFlops or other.hasFlops;
+    numMeasurements += other.numMeasurements;
+    return *this;
+  }
+
+  /**
+   * Returns string representation.
+   * @return
+   */
+  std::string toString() const {
+    std::ostringstream ss;
+    ss << "{IPC: " << getIPC() << " , LLC miss rate: " << getLLCMissRate()
+       << " , LLC MPKI: " << getLLCMissesPerKiloInstruction();
+    if (hasFlops) {
+      ss << " , Flops per cycle: " << getFlopsPerCycle();
+    }
+    ss << " , Measurements: " << numMeasurements << "}";
+    return ss.str();
+  }
+};
+
+/**
+ * Collects hardware performance counters of all OpenMP threads via the Linux perf_event_open interface.
+ *
+ * On construction every thread of the OpenMP pool opens its own counter groups, which follow the thread no matter
+ * which code it executes. Between start() and stop() they count user space events of the calling process only.
+ * If the counters can not be opened, e.g. because of the kernel's perf_event_paranoid setting, in a virtual machine
+ * without PMU or on other operating systems, isAvailable() returns false and all measurements are zero.
+ *
+ * Flops are counted with the FP_ARITH_INST_RETIRED events of Intel processors and are unavailable elsewhere.
+ */
+class PerformanceCounters {
+ public:
+  /**
+   * Constructor. Opens the counters for every thread of the OpenMP pool.
+   */
+  PerformanceCounters() {
+#if defined(__linux__)
+    const int numThreads = autopas_get_max_threads();
+    _threadGroups.resize(numThreads);
+    const bool countFlops = isIntelProcessor();
+#if defined(AUTOPAS_OPENMP)
+#pragma omp parallel num_threads(numThreads)
+#endif
+    { _threadGroups[autopas_get_thread_num()] = openThreadGroups(countFlops); }
+
+    _available = true;
+    for (const auto &groups : _threadGroups) {
+      _available = _available and not groups.empty() and groups.front().leader >= 0;
+    }
+    if (not _available) {
+      closeAll();
+      AutoPasLog(warn, "PerformanceCounters: Hardware counters are unavailable. Only timings are measured.");
+    }
+#endif
+  }
+
+  /**
+   * Destructor. Closes all counters.
+   */
+  ~PerformanceCounters() { closeAll(); }
+
+  PerformanceCounters(const PerformanceCounters &) = delete;
+
+  PerformanceCounters &operator=(const PerformanceCounters &) = delete;
+
+  /**
+   * Indicates whether the counters could be opened.
+   * @return
+   */
+  bool isAvailable() const { return _available; }
+
+  /**
+   * Reset and start all counters.
+   */
+  void start() {
+#if defined(__linux__)
+    forEachGroup([](const CounterGroup &group) {
+      ioctl(group.leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+      ioctl(group.leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    });
+#endif
+  }
+
+  /**
+   * Stop all counters and read them.
+   * @return Counts since the last call to start(), summed over all threads.
+   */
+  PerformanceCounterValues stop() {
+    PerformanceCounterValues values;
+    if (not _available) {
+      return values;
+    }
+#if defined(__linux__)
+    forEachGroup([](const CounterGroup &group) { ioctl(group.leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP); });
+    std::array<double, numEvents> counts{};
+    forEachGroup([&](const CounterGroup &group) { readGroup(group, counts); });
+    values.cycles = counts[cyclesEvent];
+    values.instructions = counts[instructionsEvent];
+    values.llcReferences = counts[llcReferencesEvent];
+    values.llcMisses = counts[llcMissesEvent];
+    values.hasFlops = _threadGroups.front().size() > 1;
+    values.flops = counts[scalarDoubleEvent] + 2. * counts[packed128DoubleEvent] + 4. * counts[packed256DoubleEvent] +
+                   8. * counts[packed512DoubleEvent];
+#endif
+    values.numMeasurements = 1;
+    return values;
+  }
+
+ private:
+  /**
+   * Events that are counted.
+   */
+  enum Event {
+    cyclesEvent,
+    instructionsEvent,
+    llcReferencesEvent,
+    llcMissesEvent,
+    scalarDoubleEvent,
+    packed128DoubleEvent,
+    packed256DoubleEvent,
+    packed512DoubleEvent,
+    numEvents,
+  };
+
+  /**
+   * Counters that are scheduled together on the PMU of one thread.
+   */
+  struct CounterGroup {
+    /**
+     * File descriptor of the group leader. Negative if the group could not be opened.
+     */
+    int leader{-1};
+    /**
+     * File descriptors of all counters in the group including the leader.
+     */
+    std::vector<int> fds{};
+    /**
+     * Event of each counter in fds.
+     */
+    std::vector<Event> events{};
+  };
+
+#if defined(__linux__)
+  /**
+   * Opens one counter for the calling thread.
+   * @param type
+   * @param config
+   * @param groupLeader File descriptor of the group leader or -1 to open a new group.
+   * @return file descriptor or a negative value on failure.
+   */
+  static int openCounter(uint32_t type, uint64_t config, int groupLeader) {
+    perf_event_attr attr{};
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = groupLeader < 0 ? 1 : 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, groupLeader, 0));
+  }
+
+  /**
+   * Opens a group of counters for the calling thread. Counters the processor does not support are left out.
+   * @param events Pairs of perf event type and config.
+   * @param eventIds
+   * @return group, whose leader is negative if no counter could be opened.
+   */
+  static CounterGroup openGroup(const std::vector<std::pair<uint32_t, uint64_t>> &events,
+                                const std::vector<Event> &eventIds) {
+    CounterGroup group;
+    for (size_t i = 0; i < events.size(); ++i) {
+      const int fd = openCounter(events[i].first, events[i].second, group.leader);
+      if (fd < 0) {
+        continue;
+      }
+      if (group.leader < 0) {
+        group.leader = fd;
+      }
+      group.fds.push_back(fd);
+      group.events.push_back(eventIds[i]);
+    }
+    return group;
+  }
+
+  /**
+   * Opens all counter groups of the calling thread.
+   * @param countFlops
+   * @return groups. The first one holds cycles, instructions and cache events, the optional second one the flops.
+   */
+  static std::vector<CounterGroup> openThreadGroups(bool countFlops) {
+    std::vector<CounterGroup> groups;
+    groups.push_back(openGroup({{PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+                                {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+                                {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES},
+                                {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES}},
+                               {cyclesEvent, instructionsEvent, llcReferencesEvent, llcMissesEvent}));
+    if (countFlops) {
+      // FP_ARITH_INST_RETIRED (event 0xC7) with the umasks for scalar, 128, 256 and 512 bit double precision
+      auto flopsGroup = openGroup({{PERF_TYPE_RAW, 0x01C7},
+                                   {PERF_TYPE_RAW, 0x04C7},
+                                   {PERF_TYPE_RAW, 0x10C7},
+                                   {PERF_TYPE_RAW, 0x40C7}},
+                                  {scalarDoubleEvent, packed128DoubleEvent, packed256DoubleEvent,
+                                   packed512DoubleEvent});
+      if (flopsGroup.leader >= 0) {
+        groups.push_back(std::move(flopsGroup));
+      }
+    }
+    return groups;
+  }
+
+  /**
+   * Reads a group and adds its counts, extrapolated to the full time if the kernel multiplexed the counters.
+   * @param group
+   * @param counts
+   */
+  static void readGroup(const CounterGroup &group, std::array<double, numEvents> &counts) {
+    // layout of PERF_FORMAT_GROUP: nr, time_enabled, time_running, value[nr]
+    std::vector<uint64_t> buffer(3 + group.fds.size());
+    const auto bytes = read(group.leader, buffer.data(), buffer.size() * sizeof(uint64_t));
+    if (bytes < static_cast<ssize_t>(3 * sizeof(uint64_t)) or buffer[2] == 0) {
+      return;
+    }
+    const double scale = static_cast<double>(buffer[1]) / static_cast<double>(buffer[2]);
+    for (size_t i = 0; i < std::min<uint64_t>(buffer[0], group.fds.size()); ++i) {
+      counts[group.events[i]] += static_cast<double>(buffer[3 + i]) * scale;
+    }
+  }
+
+  /**
+   * Checks whether the processor understands the raw Intel flop events.
+   * @return
+   */
+  static bool isIntelProcessor() {
+#if defined(__x86_64__)
+    unsigned int eax, ebx, ecx, edx;
+    if (__get_cpuid(0, &eax, &ebx, &ecx, &edx) == 0) {
+      return false;
+    }
+    // vendor string "GenuineIntel" is stored in ebx, edx, ecx
+    return ebx == 0x756e6547 and edx == 0x49656e69 and ecx == 0x6c65746e;
+#else
+    return false;
+#endif
+  }
+#endif
+
+  /**
+   * Apply a function to every counter group of every thread.
+   * @tparam Function
+   * @param function
+   */
+  template <class Function>
+  void forEachGroup(Function function) const {
+    for (const auto &groups : _threadGroups) {
+      for (const auto &group : groups) {
+        function(group);
+      }
+    }
+  }
+
+  /**
+   * Close all file descriptors.
+   */
+  void closeAll() {
+#if defined(__linux__)
+    forEachGroup([](const CounterGroup &group) {
+      for (auto fd : group.fds) {
+        close(fd);
+      }
+    });
+#endif
+    _threadGroups.clear();
+    _available = false;
+  }
+
+  /**
+   * Counter groups of every OpenMP thread.
+   */
+  std::vector<std::vector<CounterGroup>> _threadGroups;
+  bool _available{false};
+};
+
+}  // namespace autopas::utils
@@ -0,0 +1,82 @@
+/**
+ * @file ScopedOpenMPSettings.h
+ * @author F. Gratl
+ * @date 16.10.26
+ */
+
+#pragma once
+
+#include "autopas/options/ScheduleOption.h"
+#include "autopas/utils/WrapOpenMP.h"
+
+namespace autopas::utils {
+
+/**
+ * Sets the number of threads and the runtime loop schedule of OpenMP for the lifetime of this object.
+ *
+ * The previous settings are restored on destruction. Parallel regions started in the meantime use the given number of
+ * threads and all loops with schedule(runtime) use the given schedule. Without OpenMP this class does nothing.
+ */
+class ScopedOpenMPSettings {
+ public:
+  /**
+   * Constructor. Applies the settings.
+   * @param numThreads Number of threads for subsequent parallel regions. 0 keeps the current number.
+   * @param schedule Schedule kind for loops with schedule(runtime).
+   * @param chunkSize Chunk size for loops with schedule(runtime). 0 selects the OpenMP default for the kind.
+   */
+  ScopedOpenMPSettings(unsigned int numThreads, ScheduleOption schedule, unsigned int chunkSize) {
+#if defined(AUTOPAS_OPENMP)
+    _previousNumThreads = omp_get_max_threads();
+    omp_get_schedule(&_previousScheduleKind, &_previousChunkSize);
+
+    if (numThreads > 0) {
+      omp_set_num_threads(static_cast<int>(numThreads));
+    }
+    switch (schedule) {
+      case ScheduleOption::staticSchedule: {
+        omp_set_schedule(omp_sched_static, static_cast<int>(chunkSize));
+        break;
+      }
+      case ScheduleOption::dynamicSchedule: {
+        omp_set_schedule(omp_sched_dynamic, static_cast<int>(chunkSize));
+        break;
+      }
+      case ScheduleOption::guidedSchedule: {
+        omp_set_schedule(omp_sched_guided, static_cast<int>(chunkSize));
+        break;
+      }
+    }
+#endif
+  }
+
+  /**
+   * Destructor. Restores the previous settings.
+   */
+  ~ScopedOpenMPSettings() {
+#if defined(AUTOPAS_OPENMP)
+    omp_set_num_threads(_previousNumThreads);
+    omp_set_schedule(_previousScheduleKind, _previousChunkSize);
+#endif
+  }
+
+  /**
+   * Copy constructor. Deleted since settings must be restored exactly once.
+   */
+  ScopedOpenMPSettings(const ScopedOpenMPSettings &) = delete;
+
+  /**
+   * Copy assignment operator. Deleted since settings must be restored exactly once.
+   * @return
+   */
+  ScopedOpenMPSettings &operator=(const ScopedOpenMPSettings &) = delete;
+
+ private:
+#if defined(AUTOPAS_OPENMP)
+  int _previousNumThreads;
+  omp_sched_t _previousScheduleKind;
+  int _previousChunkSize;
+#endif
+};
+
+}  // namespace autopas::utils
@@ -0,0 +1,232 @@
+/**
+ * @file TraceRecorder.h
+ * @author F. Gratl
+ * @date 17.10.26
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "autopas/utils/ExceptionHandler.h"
+
+namespace autopas::utils {
+
+/**
+ * Records when every thread works on which phase of a traversal and writes the timeline in the Chrome trace event
+ * format, which can be viewed in chrome://tracing or https://ui.perfetto.dev.
+ *
+ * Recording is disabled by default. Every thread appends its events to its own buffer, so recording needs neither locks
+ * nor atomics apart from the check whether recording is enabled. A buffer is registered once per thread on its first
+ * event. clear() and writeChromeTrace() must not be called while a traversal is running.
+ */
+class TraceRecorder {
+ public:
+  /**
+   * One time span of one thread.
+   */
+  struct Event {
+    /**
+     * Name of the phase. Has to point to a string literal.
+     */
+    const char *name;
+    /**
+     * Index of the color, slice, etc. Negative if there is none.
+     */
+    long index;
+    /**
+     * Begin in microseconds since the start of the program.
+     */
+    double begin;
+    /**
+     * End in microseconds since the start of the program.
+     */
+    double end;
+  };
+
+  /**
+   * Enable or disable recording.
+   * @param enabled
+   */
+  static void setEnabled(bool enabled) { getState().enabled.store(enabled, std::memory_order_relaxed); }
+
+  /**
+   * Indicates whether events are recorded.
+   * @return
+   */
+  static bool isEnabled() { return getState().enabled.load(std::memory_order_relaxed); }
+
+  /**
+   * Current time in microseconds since the start of the program.
+   * @return
+   */
+  static double now() {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - getState().start).count();
+  }
+
+  /**
+   * Append an event to the buffer of the calling thread.
+   * @param name Name of the phase. Has to point to a string literal.
+   * @param index Index of the color, slice, etc. Negative if there is none.
+   * @param begin
+   * @param end
+   */
+  static void record(const char *name, long index, double begin, double end) {
+    getThreadBuffer().events.push_back({name, index, begin, end});
+  }
+
+  /**
+   * Delete all recorded events.
+   */
+  static void clear() {
+    auto &state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    for (auto &buffer : state.buffers) {
+      buffer->events.clear();
+    }
+  }
+
+  /**
+   * Get the events of all threads.
+   * @return Events ordered by thread and within a thread by time.
+   */
+  static std::vector<Event> getEvents() {
+    auto &state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    std::vector<Event> events;
+    for (const auto &buffer : state.buffers) {
+      events.insert(events.end(), buffer->events.begin(), buffer->events.end());
+    }
+    return events;
+  }
+
+  /**
+   * Write all recorded events as Chrome trace JSON.
+   * @param filename
+   */
+  static void writeChromeTrace(const std::string &filename) {
+    std::ofstream out(filename, std::ios::trunc);
+    if (not out.is_open()) {
+      ExceptionHandler::exception("TraceRecorder: Could not write to {}", filename);
+    }
+
+    auto &state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    bool first = true;
+    for (const auto &buffer : state.buffers) {
+      out << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << buffer->threadId
+          << ",\"args\":{\"name\":\"thread " << buffer->threadId << "\"}}";
+      first = false;
+      for (const auto &event : buffer->events) {
+        out << ",\n{\"name\":\"" << event.name << "\",\"cat\":\"traversal\",\"ph\":\"X\",\"pid\":0,\"tid\":"
+            << buffer->threadId << ",\"ts\":" << event.begin << ",\"dur\":" << event.end - event.begin;
+        if (event.index >= 0) {
+          out << ",\"args\":{\"index\":" << event.index << "}";
+        }
+        out << "}";
+      }
+    }
+    out << "\n]}\n";
+  }
+
+ private:
+  /**
+   * Events of one thread.
+   */
+  struct ThreadBuffer {
+    /**
+     * Id of the thread in the trace, given in the order of registration.
+     */
+    size_t threadId;
+    /**
+     * Events in the order they were recorded.
+     */
+    std::vector<Event> events{};
+  };
+
+  /**
+   * Global state of the recorder.
+   */
+  struct State {
+    /**
+     * Whether events are recorded.
+     */
+    std::atomic<bool> enabled{false};
+    /**
+     * Reference point of all time stamps.
+     */
+    std::chrono::steady_clock::time_point start{std::chrono::steady_clock::now()};
+    /**
+     * Guards buffers.
+     */
+    std::mutex mutex;
+    /**
+     * Buffers of all threads that recorded an event so far.
+     */
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+  };
+
+  /**
+   * Get the global state, which is created on first use.
+   * @return
+   */
+  static State &getState() {
+    static State state;
+    return state;
+  }
+
+  /**
+   * Get the buffer of the calling thread and register it on first use.
+   * @return
+   */
+  static ThreadBuffer &getThreadBuffer() {
+    thread_local std::shared_ptr<ThreadBuffer> buffer = [] {
+      auto &state = getState();
+      std::lock_guard<std::mutex> lock(state.mutex);
+      state.buffers.push_back(std::make_shared<ThreadBuffer>(ThreadBuffer{state.buffers.size()}));
+      return state.buffers.back();
+    }();
+    return *buffer;
+  }
+};
+
+/**
+ * Records the lifetime of the scope as one event of the calling thread if the TraceRecorder is enabled.
+ */
+class TraceScope {
+ public:
+  /**
+   * Constructor. Starts the event.
+   * @param name Name of the phase. Has to point to a string literal.
+   * @param index Index of the color, slice, etc. Negative if there is none.
+   */
+  explicit TraceScope(const char *name, long index = -1)
+      : _name(name), _index(index), _begin(TraceRecorder::isEnabled() ? TraceRecorder::now() : -1.) {}
+
+  /**
+   * Destructor. Ends the event.
+   */
+  ~TraceScope() {
+    if (_begin >= 0.) {
+      TraceRecorder::record(_name, _index, _begin, TraceRecorder::now());
+    }
+  }
+
+  TraceScope(const TraceScope &) = delete;
+
+  TraceScope &operator=(const TraceScope &) = delete;
+
+ private:
+  const char *_name;
+  long _index;
+  double _begin;
+};
+
+}  // namespace autopas::utils
@@ -40,6 +40,20 @@ class MockFunctor : public autopas::Functor<Particle, ParticleCell_t> {
                bool newton3),
               (override));
 
+  // virtual void SoAFunctor(SoAView &soa, const CSRNeighborLists<size_t> &neighborList, size_t iFrom, size_t iTo,
+  // bool newton3)
+  MOCK_METHOD(void, SoAFunctor,
+              (autopas::SoAView<typename Particle::SoAArraysType> soa, const autopas::CSRNeighborLists<size_t> &,
+               size_t, size_t, bool newton3),
+              (override));
+
+  // virtual void SoAFunctor(SoAView &soa, const CSRNeighborLists<uint32_t> &neighborList, size_t iFrom, size_t iTo,
+  // bool newton3)
+  MOCK_METHOD(void, SoAFunctor,
+              (autopas::SoAView<typename Particle::SoAArraysType> soa, const autopas::CSRNeighborLists<uint32_t> &,
+               size_t, size_t, bool newton3),
+              (override));
+
   // virtual void SoALoader(ParticleCell &cell, autopas::SoA &soa, size_t
   // offset=0) {}
   // no override for the two-input variant, as it only simulates the one with a default argument!
@@ -6,6 +6,8 @@
 
 #include "AutoPasTest.h"
 
+#include <fstream>
+
 #include "testingHelpers/commonTypedefs.h"
 
 using ::testing::_;
@@ -247,4 +249,111 @@ TEST_F(AutoPasTest, getNumParticlesIteratorTest) {
     --numParticles;
     expectedParticles(numParticles, 0);
   }
-}
\ No newline at end of file
+}
+/**
+ * Every call of iteratePairwise() has to produce one telemetry record with the configuration and particle counts.
+ */
+TEST_F(AutoPasTest, telemetryTest) {
+  const std::string filename{"autoPasTelemetryTest.csv"};
+  const size_t numIterations = 3;
+  {
+    decltype(autoPas) autoPasTelemetry;
+    autoPasTelemetry.setBoxMin({0., 0., 0.});
+    autoPasTelemetry.setBoxMax({5., 5., 5.});
+    autoPasTelemetry.setCutoff(1.);
+    autoPasTelemetry.setAllowedContainers({autopas::ContainerOption::linkedCells});
+    autoPasTelemetry.setAllowedTraversals({autopas::TraversalOption::c08});
+    autoPasTelemetry.setAllowedDataLayouts({autopas::DataLayoutOption::aos});
+    autoPasTelemetry.setAllowedNewton3Options({autopas::Newton3Option::enabled});
+    autoPasTelemetry.setTelemetryFile(filename);
+    autoPasTelemetry.init();
+
+    Particle p1({1., 1., 1.}, {0., 0., 0.}, 0);
+    autoPasTelemetry.addParticle(p1);
+    Particle p2({1.5, 1., 1.}, {0., 0., 0.}, 1);
+    autoPasTelemetry.addParticle(p2);
+
+    MFunctor functor;
+    EXPECT_CALL(functor, isRelevantForTuning()).WillRepeatedly(Return(true));
+    EXPECT_CALL(functor, allowsNewton3()).WillRepeatedly(Return(true));
+    EXPECT_CALL(functor, allowsNonNewton3()).WillRepeatedly(Return(true));
+    EXPECT_CALL(functor, AoSFunctor(_, _, true)).Times(AtLeast(1));
+    for (size_t i = 0; i < numIterations; ++i) {
+      auto invalidParticles = autoPasTelemetry.updateContainer();
+      EXPECT_TRUE(invalidParticles.first.empty());
+      autoPasTelemetry.iteratePairwise(&functor);
+    }
+  }
+
+  std::ifstream in(filename);
+  std::vector<std::string> lines;
+  for (std::string line; std::getline(in, line);) {
+    lines.push_back(line);
+  }
+  std::remove(filename.c_str());
+
+  ASSERT_EQ(lines.size(), numIterations + 1);
+  EXPECT_EQ(lines[0], autopas::TelemetryWriter::getCsvHeader());
+  for (size_t i = 0; i < numIterations; ++i) {
+    EXPECT_EQ(lines[i + 1].rfind(std::to_string(i) + ",LinkedCells,1,c08,AoS,enabled,", 0), 0) << lines[i + 1];
+    // owned and halo particles are the last columns
+    EXPECT_EQ(lines[i + 1].substr(lines[i + 1].size() - 4), ",2,0") << lines[i + 1];
+  }
+}
+
+/**
+ * With rebuildOnDisplacement the container has to be invalidated as soon as a particle moved more than half the skin,
+ * even if the rebuild frequency is not reached yet.
+ */
+TEST_F(AutoPasTest, rebuildOnDisplacementTest) {
+  decltype(autoPas) autoPasDisplacement;
+  autoPasDisplacement.setBoxMin({0., 0., 0.});
+  autoPasDisplacement.setBoxMax({5., 5., 5.});
+  autoPasDisplacement.setCutoff(1.);
+  autoPasDisplacement.setVerletSkin(.2);
+  autoPasDisplacement.setVerletRebuildFrequency(100);
+  autoPasDisplacement.setTuningInterval(1000);
+  autoPasDisplacement.setAllowedContainers({autopas::ContainerOption::verletLists});
+  autoPasDisplacement.setAllowedTraversals({autopas::TraversalOption::verletTraversal});
+  autoPasDisplacement.setAllowedDataLayouts({autopas::DataLayoutOption::aos});
+  autoPasDisplacement.setAllowedNewton3Options({autopas::Newton3Option::enabled});
+  autoPasDisplacement.setRebuildOnDisplacement(true);
+  autoPasDisplacement.init();
+
+  Particle p1({1., 1., 1.}, {0., 0., 0.}, 0);
+  autoPasDisplacement.addParticle(p1);
+  Particle p2({1.5, 1., 1.}, {0., 0., 0.}, 1);
+  autoPasDisplacement.addParticle(p2);
+
+  MFunctor functor;
+  EXPECT_CALL(functor, isRelevantForTuning()).WillRepeatedly(Return(true));
+  EXPECT_CALL(functor, allowsNewton3()).WillRepeatedly(Return(true));
+  EXPECT_CALL(functor, allowsNonNewton3()).WillRepeatedly(Return(true));
+  EXPECT_CALL(functor, AoSFunctor(_, _, true)).Times(AtLeast(1));
+
+  // the first updates invalidate the container until the lists are built
+  autoPasDisplacement.iteratePairwise(&functor);
+  EXPECT_FALSE(autoPasDisplacement.updateContainer().second);
+  autoPasDisplacement.iteratePairwise(&functor);
+
+  auto moveFirstParticle = [&](double dx) {
+    for (auto iter = autoPasDisplacement.begin(); iter.isValid(); ++iter) {
+      if (iter->getID() == 0) {
+        iter->addR({dx, 0., 0.});
+      }
+    }
+  };
+
+  // less than half the skin
+  moveFirstParticle(.05);
+  EXPECT_FALSE(autoPasDisplacement.updateContainer().second);
+  autoPasDisplacement.iteratePairwise(&functor);
+
+  // in total more than half the skin
+  moveFirstParticle(.06);
+  EXPECT_TRUE(autoPasDisplacement.updateContainer().second);
+  autoPasDisplacement.iteratePairwise(&functor);
+
+  // the rebuild resets the reference positions
+  EXPECT_FALSE(autoPasDisplacement.updateContainer().second);
+}
@@ -11,6 +11,7 @@
 #include "autopas/molecularDynamics/LJFunctor.h"
 
 using ::testing::_;
+using ::testing::A;
 using ::testing::AtLeast;
 using ::testing::Each;
 using ::testing::Eq;
@@ -492,7 +493,7 @@ TEST_P(VerletListsTest, LoadExtractSoA) {
   const size_t numCells = dimWithHalo * dimWithHalo * dimWithHalo;
   EXPECT_CALL(mockFunctor, SoALoaderVerlet(_, _, _)).Times(numCells);
   EXPECT_CALL(mockFunctor, SoAExtractorVerlet(_, _, _)).Times(numCells);
-  EXPECT_CALL(mockFunctor, SoAFunctor(_, _, _, _, _)).Times(1);
+  EXPECT_CALL(mockFunctor, SoAFunctor(_, A<const autopas::CSRNeighborLists<size_t> &>(), _, _, _)).Times(1);
 
   verletLists.rebuildNeighborLists(&verletTraversal);
   verletLists.iteratePairwise(&verletTraversal);
@@ -559,4 +560,188 @@ TEST_P(VerletListsTest, SoAvsAoSLJ) {
   EXPECT_FALSE(iter2.isValid());
 }
 
-INSTANTIATE_TEST_SUITE_P(Generated, VerletListsTest, Values(1.0, 2.0), VerletListsTest::PrintToStringParamName());
\ No newline at end of file
+INSTANTIATE_TEST_SUITE_P(Generated, VerletListsTest, Values(1.0, 2.0), VerletListsTest::PrintToStringParamName());
+/**
+ * The lists of both build types with and without newton3 have to contain exactly the pairs that are found by comparing
+ * all particles with each other.
+ */
+TEST_P(VerletListsTest, NeighborListsMatchBruteForce) {
+  const double cutoff = 2.;
+  const double skin = 0.3;
+  const double cellSizeFactor = GetParam();
+
+  for (auto buildType : {autopas::VerletLists<Particle>::BuildVerletListType::VerletAoS,
+                         autopas::VerletLists<Particle>::BuildVerletListType::VerletSoA}) {
+    for (bool newton3 : {false, true}) {
+      autopas::VerletLists<Particle> verletLists({0., 0., 0.}, {10., 10., 10.}, cutoff, skin, buildType,
+                                                 cellSizeFactor);
+      Particle defaultParticle({0., 0., 0.}, {0., 0., 0.}, 0);
+      autopasTools::generators::RandomGenerator::fillWithParticles(
+          verletLists, defaultParticle, verletLists.getBoxMin(), verletLists.getBoxMax(), 300);
+      // ids of the halo particles start after the ones of the owned particles
+      Particle defaultHaloParticle({0., 0., 0.}, {0., 0., 0.}, 1000);
+      autopasTools::generators::RandomGenerator::fillWithHaloParticles(verletLists, defaultHaloParticle, cutoff, 50);
+
+      MockFunctor<Particle, FPCell> mockFunctor;
+      std::unique_ptr<autopas::TraversalInterface> traversal;
+      if (newton3) {
+        traversal =
+            std::make_unique<autopas::TraversalVerlet<FPCell, MFunctor, autopas::DataLayoutOption::aos, true>>(
+                &mockFunctor);
+      } else {
+        traversal =
+            std::make_unique<autopas::TraversalVerlet<FPCell, MFunctor, autopas::DataLayoutOption::aos, false>>(
+                &mockFunctor);
+      }
+      verletLists.rebuildNeighborLists(traversal.get());
+
+      std::set<std::pair<unsigned long, unsigned long>> expectedPairs;
+      for (auto iterI = verletLists.begin(); iterI.isValid(); ++iterI) {
+        for (auto iterJ = verletLists.begin(); iterJ.isValid(); ++iterJ) {
+          const auto dist = autopas::utils::ArrayMath::sub(iterI->getR(), iterJ->getR());
+          if (iterI->getID() < iterJ->getID() and
+              autopas::utils::ArrayMath::dot(dist, dist) < (cutoff + skin) * (cutoff + skin)) {
+            expectedPairs.insert({iterI->getID(), iterJ->getID()});
+          }
+        }
+      }
+
+      std::set<std::pair<unsigned long, unsigned long>> pairs;
+      size_t numEntries = 0;
+      for (const auto &[particle, neighbors] : verletLists.getVerletListsAoS()) {
+        for (auto *neighbor : neighbors) {
+          pairs.insert(std::minmax(particle->getID(), neighbor->getID()));
+          ++numEntries;
+        }
+      }
+      EXPECT_EQ(pairs, expectedPairs) << "newton3: " << newton3;
+      // without newton3 every pair is stored in the lists of both particles
+      EXPECT_EQ(numEntries, (newton3 ? 1 : 2) * expectedPairs.size()) << "newton3: " << newton3;
+      EXPECT_EQ(verletLists.getVerletListsSoA().getNumNeighbors(), numEntries);
+    }
+  }
+}
+
+/**
+ * After moving the particles in one corner of the domain an incremental rebuild keeps the lists elsewhere. As the other
+ * particles did not move at all, the lists have to contain exactly the pairs found by comparing all particles.
+ */
+TEST_P(VerletListsTest, IncrementalRebuildMatchesBruteForce) {
+  const double cutoff = 2.;
+  const double skin = 0.3;
+  const double cellSizeFactor = GetParam();
+
+  for (bool newton3 : {false, true}) {
+    autopas::VerletLists<Particle> verletLists({0., 0., 0.}, {10., 10., 10.}, cutoff, skin,
+                                               autopas::VerletLists<Particle>::BuildVerletListType::VerletSoA,
+                                               cellSizeFactor, .2);
+    Particle defaultParticle({0., 0., 0.}, {0., 0., 0.}, 0);
+    autopasTools::generators::RandomGenerator::fillWithParticles(verletLists, defaultParticle, verletLists.getBoxMin(),
+                                                                 verletLists.getBoxMax(), 300);
+    Particle defaultHaloParticle({0., 0., 0.}, {0., 0., 0.}, 1000);
+    autopasTools::generators::RandomGenerator::fillWithHaloParticles(verletLists, defaultHaloParticle, cutoff, 50);
+
+    MockFunctor<Particle, FPCell> mockFunctor;
+    std::unique_ptr<autopas::TraversalInterface> traversal;
+    if (newton3) {
+      traversal = std::make_unique<autopas::TraversalVerlet<FPCell, MFunctor, autopas::DataLayoutOption::aos, true>>(
+          &mockFunctor);
+    } else {
+      traversal = std::make_unique<autopas::TraversalVerlet<FPCell, MFunctor, autopas::DataLayoutOption::aos, false>>(
+          &mockFunctor);
+    }
+    verletLists.rebuildNeighborLists(traversal.get());
+
+    for (size_t step = 0; step < 3; ++step) {
+      // move the owned particles in one corner, some of them into other cells
+      for (auto iter = verletLists.begin(autopas::IteratorBehavior::ownedOnly); iter.isValid(); ++iter) {
+        const auto &r = iter->getR();
+        if (r[0] < 3. and r[1] < 3. and r[2] < 3.) {
+          iter->setR({std::max(.01, r[0] + (step == 1 ? -.5 : .4)), r[1], r[2]});
+        }
+      }
+      // updating the container deletes the halo particles, so they are added again in the same order
+      std::vector<Particle> haloParticles;
+      for (auto iter = verletLists.begin(autopas::IteratorBehavior::haloOnly); iter.isValid(); ++iter) {
+        haloParticles.push_back(*iter);
+      }
+      auto invalidParticles = verletLists.updateContainer();
+      EXPECT_TRUE(invalidParticles.empty());
+      for (const auto &haloParticle : haloParticles) {
+        verletLists.addHaloParticle(haloParticle);
+      }
+      verletLists.rebuildNeighborLists(traversal.get());
+
+      std::set<std::pair<unsigned long, unsigned long>> expectedPairs;
+      for (auto iterI = verletLists.begin(); iterI.isValid(); ++iterI) {
+        for (auto iterJ = verletLists.begin(); iterJ.isValid(); ++iterJ) {
+          const auto dist = autopas::utils::ArrayMath::sub(iterI->getR(), iterJ->getR());
+          if (iterI->getID() < iterJ->getID() and
+              autopas::utils::ArrayMath::dot(dist, dist) < (cutoff + skin) * (cutoff + skin)) {
+            expectedPairs.insert({iterI->getID(), iterJ->getID()});
+          }
+        }
+      }
+
+      std::set<std::pair<unsigned long, unsigned long>> pairs;
+      size_t numEntries = 0;
+      for (const auto &[particle, neighbors] : verletLists.getVerletListsAoS()) {
+        for (auto *neighbor : neighbors) {
+          pairs.insert(std::minmax(particle->getID(), neighbor->getID()));
+          ++numEntries;
+        }
+      }
+      EXPECT_EQ(pairs, expectedPairs) << "newton3: " << newton3 << " step: " << step;
+      EXPECT_EQ(numEntries, (newton3 ? 1 : 2) * expectedPairs.size()) << "newton3: " << newton3 << " step: " << step;
+    }
+  }
+}
+
+/**
+ * Compact neighbor lists have to contain the same neighbors as the regular ones and yield the same forces.
+ */
+TEST_P(VerletListsTest, CompactNeighborListsLJ) {
+  const double cutoff = 2.;
+  const double cellSizeFactor = GetParam();
+  autopas::VerletLists<Molecule> verletLists({0., 0., 0.}, {10., 10., 10.}, cutoff, 0.3,
+                                             autopas::VerletLists<Molecule>::BuildVerletListType::VerletSoA,
+                                             cellSizeFactor);
+
+  autopas::VerletLists<Molecule> verletListsCompact({0., 0., 0.}, {10., 10., 10.}, cutoff, 0.3,
+                                                    autopas::VerletLists<Molecule>::BuildVerletListType::VerletSoA,
+                                                    cellSizeFactor, 0., true);
+
+  Molecule defaultParticle({0., 0., 0.}, {0., 0., 0.}, 0, 0);
+  autopasTools::generators::RandomGenerator::fillWithParticles(verletLists, defaultParticle, verletLists.getBoxMin(),
+                                                               verletLists.getBoxMax(), 100);
+  autopasTools::generators::RandomGenerator::fillWithParticles(
+      verletListsCompact, defaultParticle, verletListsCompact.getBoxMin(), verletListsCompact.getBoxMax(), 100);
+  autopas::LJFunctor<Molecule, FMCell> ljFunctor(cutoff);
+  ljFunctor.setParticleProperties(1., 1.);
+  autopas::TraversalVerlet<FMCell, autopas::LJFunctor<Molecule, FMCell>, autopas::DataLayoutOption::soa, true>
+      soaTraversal(&ljFunctor);
+  verletLists.rebuildNeighborLists(&soaTraversal);
+  verletListsCompact.rebuildNeighborLists(&soaTraversal);
+
+  EXPECT_EQ(verletListsCompact.getVerletListsSoA().getNumNeighbors(), 0);
+  ASSERT_EQ(verletListsCompact.getCompactVerletListsSoA().size(), verletLists.getVerletListsSoA().size());
+  for (size_t i = 0; i < verletLists.getVerletListsSoA().size(); ++i) {
+    const auto list = verletLists.getVerletListsSoA()[i];
+    const auto compactList = verletListsCompact.getCompactVerletListsSoA()[i];
+    EXPECT_TRUE(std::equal(list.begin(), list.end(), compactList.begin(), compactList.end())) << "particle " << i;
+  }
+
+  verletLists.iteratePairwise(&soaTraversal);
+  verletListsCompact.iteratePairwise(&soaTraversal);
+
+  auto iter1 = verletLists.begin();
+  auto iter2 = verletListsCompact.begin();
+  for (; iter1.isValid() && iter2.isValid(); ++iter1, ++iter2) {
+    for (unsigned int dim = 0; dim < 3; dim++) {
+      ASSERT_NEAR(iter1->getR()[dim], iter2->getR()[dim], fabs(iter1->getR()[dim] * 1e-7));
+      EXPECT_NEAR(iter1->getF()[dim], iter2->getF()[dim], fabs(iter1->getF()[dim] * 1e-7));
+    }
+  }
+  EXPECT_FALSE(iter1.isValid());
+  EXPECT_FALSE(iter2.isValid());
+}
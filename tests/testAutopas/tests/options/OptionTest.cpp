@@ -10,7 +10,9 @@
 #include "autopas/options/ContainerOption.h"
 #include "autopas/options/DataLayoutOption.h"
 #include "autopas/options/Newton3Option.h"
+#include "autopas/options/ScheduleOption.h"
 #include "autopas/options/SelectorStrategyOption.h"
+#include "autopas/options/TelemetryFormatOption.h"
 #include "autopas/options/TraversalOption.h"
 #include "autopas/options/TuningStrategyOption.h"
 #include "tests/utils/StringUtilsTest.h"
@@ -101,6 +103,8 @@ TEST(OptionTest, parseTuningStrategyOptionsTest) {
       {autopas::TuningStrategyOption::fullSearch, "full"},
       {autopas::TuningStrategyOption::randomSearch, "random"},
       {autopas::TuningStrategyOption::activeHarmony, "harmony"},
+      {autopas::TuningStrategyOption::successiveHalving, "halving"},
+      {autopas::TuningStrategyOption::costModelSearch, "cost-model"},
   };
 
   EXPECT_EQ(mapEnumString.size(), autopas::TuningStrategyOption::getOptionNames().size());
@@ -125,6 +129,31 @@ TEST(OptionTest, parseAcquisitionFunctionOptionsTest) {
   testParseOptionsCombined(mapEnumString);
 }
 
+TEST(OptionTest, parseScheduleOptionsTest) {
+  std::map<autopas::ScheduleOption, std::string> mapEnumString = {
+      {autopas::ScheduleOption::staticSchedule, "static"},
+      {autopas::ScheduleOption::dynamicSchedule, "dynamic"},
+      {autopas::ScheduleOption::guidedSchedule, "guided"},
+  };
+
+  EXPECT_EQ(mapEnumString.size(), autopas::ScheduleOption::getOptionNames().size());
+
+  testParseOptionsIndividually(mapEnumString);
+  testParseOptionsCombined(mapEnumString);
+}
+
+TEST(OptionTest, parseTelemetryFormatOptionsTest) {
+  std::map<autopas::TelemetryFormatOption, std::string> mapEnumString = {
+      {autopas::TelemetryFormatOption::csv, "csv"},
+      {autopas::TelemetryFormatOption::jsonLines, "json-lines"},
+  };
+
+  EXPECT_EQ(mapEnumString.size(), autopas::TelemetryFormatOption::getOptionNames().size());
+
+  testParseOptionsIndividually(mapEnumString);
+  testParseOptionsCombined(mapEnumString);
+}
+
 // Generated tests for all option types
 // parseOptionExact tests
 
@@ -163,6 +192,7 @@ REGISTER_TYPED_TEST_SUITE_P(OptionTest, parseExactOptionsTest, to_stringTest);
 
 // instantiate tests for all option types
 using OptionTypes = ::testing::Types<autopas::AcquisitionFunctionOption, autopas::ContainerOption,
-                                     autopas::DataLayoutOption, autopas::Newton3Option, autopas::SelectorStrategyOption,
+                                     autopas::DataLayoutOption, autopas::Newton3Option, autopas::ScheduleOption,
+                                     autopas::SelectorStrategyOption, autopas::TelemetryFormatOption,
                                      autopas::TraversalOption, autopas::TuningStrategyOption>;
 INSTANTIATE_TYPED_TEST_SUITE_P(GeneratedTyped, OptionTest, OptionTypes);
@@ -6,6 +6,9 @@
 
 #include "AutoTunerTest.h"
 
+#include <chrono>
+#include <thread>
+
 #include "autopas/molecularDynamics/LJFunctor.h"
 #include "autopas/selectors/AutoTuner.h"
 #include "autopas/selectors/tuningStrategy/FullSearch.h"
@@ -19,16 +22,14 @@ TEST_F(AutoTunerTest, testAllConfigurations) {
   const double cutoff = 1;
   const double cellSizeFactor = 1;
   const double verletSkin = 0;
-  const unsigned int verletClusterSize = 64;
   const unsigned int maxSamples = 2;
   autopas::LJFunctor<Molecule, FMCell> functor(cutoff);
   auto tuningStrategy = std::make_unique<autopas::FullSearch>(
       autopas::ContainerOption::getAllOptions(), std::set<double>({cellSizeFactor}),
       autopas::TraversalOption::getAllOptions(), autopas::DataLayoutOption::getAllOptions(),
-      autopas::Newton3Option::getAllOptions());
-  autopas::AutoTuner<Molecule, FMCell> autoTuner(bBoxMin, bBoxMax, cutoff, verletSkin, verletClusterSize,
-                                                 std::move(tuningStrategy), autopas::SelectorStrategyOption::fastestAbs,
-                                                 100, maxSamples);
+      autopas::Newton3Option::getAllOptions(), std::set<double>({verletSkin}), std::set<unsigned int>({1}));
+  autopas::AutoTuner<Molecule, FMCell> autoTuner(bBoxMin, bBoxMax, cutoff, std::move(tuningStrategy),
+                                                 autopas::SelectorStrategyOption::fastestAbs, 100, maxSamples);
 
   autopas::Logger::get()->set_level(autopas::Logger::LogLevel::off);
   //  autopas::Logger::get()->set_level(autopas::Logger::LogLevel::debug);
@@ -112,7 +113,7 @@ TEST_F(AutoTunerTest, testWillRebuildDDL) {
                   autopas::DataLayoutOption::aos, autopas::Newton3Option::disabled);
 
   auto tuningStrategy = std::make_unique<autopas::FullSearch>(configs);
-  autopas::AutoTuner<Particle, FPCell> autoTuner({0, 0, 0}, {10, 10, 10}, 1, 0, 64, std::move(tuningStrategy),
+  autopas::AutoTuner<Particle, FPCell> autoTuner({0, 0, 0}, {10, 10, 10}, 1, std::move(tuningStrategy),
                                                  autopas::SelectorStrategyOption::fastestAbs, 1000, 2);
 
   EXPECT_EQ(*(configs.begin()), autoTuner.getCurrentConfig());
@@ -164,7 +165,7 @@ TEST_F(AutoTunerTest, testWillRebuildDDLOneConfigKicked) {
                   autopas::DataLayoutOption::aos, autopas::Newton3Option::enabled);
 
   auto tuningStrategy = std::make_unique<autopas::FullSearch>(configs);
-  autopas::AutoTuner<Particle, FPCell> autoTuner({0, 0, 0}, {10, 10, 10}, 1, 0, 64, std::move(tuningStrategy),
+  autopas::AutoTuner<Particle, FPCell> autoTuner({0, 0, 0}, {10, 10, 10}, 1, std::move(tuningStrategy),
                                                  autopas::SelectorStrategyOption::fastestAbs, 1000, 2);
 
   EXPECT_EQ(*(configs.begin()), autoTuner.getCurrentConfig());
@@ -204,7 +205,7 @@ TEST_F(AutoTunerTest, testWillRebuildDL) {
                   autopas::DataLayoutOption::aos, autopas::Newton3Option::disabled);
 
   auto tuningStrategy = std::make_unique<autopas::FullSearch>(configs);
-  autopas::AutoTuner<Particle, FPCell> autoTuner({0, 0, 0}, {10, 10, 10}, 1, 0, 64, std::move(tuningStrategy),
+  autopas::AutoTuner<Particle, FPCell> autoTuner({0, 0, 0}, {10, 10, 10}, 1, std::move(tuningStrategy),
                                                  autopas::SelectorStrategyOption::fastestAbs, 1000, 2);
 
   EXPECT_EQ(*(configs.begin()), autoTuner.getCurrentConfig());
@@ -241,7 +242,7 @@ TEST_F(AutoTunerTest, testNoConfig) {
   auto exp1 = []() {
     std::set<autopas::Configuration> configsList = {};
     auto tuningStrategy = std::make_unique<autopas::FullSearch>(configsList);
-    autopas::AutoTuner<Particle, FPCell> autoTuner({0, 0, 0}, {10, 10, 10}, 1, 0, 64, std::move(tuningStrategy),
+    autopas::AutoTuner<Particle, FPCell> autoTuner({0, 0, 0}, {10, 10, 10}, 1, std::move(tuningStrategy),
                                                    autopas::SelectorStrategyOption::fastestAbs, 1000, 3);
   };
 
@@ -255,7 +256,7 @@ TEST_F(AutoTunerTest, testNoConfig) {
     std::set<autopas::DataLayoutOption> dl = {};
     std::set<autopas::Newton3Option> n3 = {};
     auto tuningStrategy = std::make_unique<autopas::FullSearch>(co, csf, tr, dl, n3);
-    autopas::AutoTuner<Particle, FPCell> autoTuner({0, 0, 0}, {10, 10, 10}, 1, 0, 64, std::move(tuningStrategy),
+    autopas::AutoTuner<Particle, FPCell> autoTuner({0, 0, 0}, {10, 10, 10}, 1, std::move(tuningStrategy),
                                                    autopas::SelectorStrategyOption::fastestAbs, 1000, 3);
   };
 
@@ -272,7 +273,7 @@ TEST_F(AutoTunerTest, testOneConfig) {
   auto configsList = {conf};
   auto tuningStrategy = std::make_unique<autopas::FullSearch>(configsList);
   size_t maxSamples = 3;
-  autopas::AutoTuner<Particle, FPCell> tuner({0, 0, 0}, {10, 10, 10}, 1, 0, 64, std::move(tuningStrategy),
+  autopas::AutoTuner<Particle, FPCell> tuner({0, 0, 0}, {10, 10, 10}, 1, std::move(tuningStrategy),
                                              autopas::SelectorStrategyOption::fastestAbs, 1000, maxSamples);
 
   EXPECT_EQ(conf, tuner.getCurrentConfig());
@@ -307,7 +308,7 @@ TEST_F(AutoTunerTest, testConfigSecondInvalid) {
 
   auto configsList = {confNoN3, confN3};
   auto tuningStrategy = std::make_unique<autopas::FullSearch>(configsList);
-  autopas::AutoTuner<Particle, FPCell> tuner({0, 0, 0}, {10, 10, 10}, 1, 0, 64, std::move(tuningStrategy),
+  autopas::AutoTuner<Particle, FPCell> tuner({0, 0, 0}, {10, 10, 10}, 1, std::move(tuningStrategy),
                                              autopas::SelectorStrategyOption::fastestAbs, 1000, 3);
 
   EXPECT_EQ(confNoN3, tuner.getCurrentConfig());
@@ -339,7 +340,7 @@ TEST_F(AutoTunerTest, testLastConfigThrownOut) {
 
   auto configsList = {confN3, confNoN3};
   auto tuningStrategy = std::make_unique<autopas::FullSearch>(configsList);
-  autopas::AutoTuner<Particle, FPCell> tuner({0, 0, 0}, {10, 10, 10}, 1, 0, 64, std::move(tuningStrategy),
+  autopas::AutoTuner<Particle, FPCell> tuner({0, 0, 0}, {10, 10, 10}, 1, std::move(tuningStrategy),
                                              autopas::SelectorStrategyOption::fastestAbs, 1000, 3);
 
   EXPECT_EQ(confN3, tuner.getCurrentConfig());
@@ -352,3 +353,331 @@ TEST_F(AutoTunerTest, testLastConfigThrownOut) {
   bool doRebuild = true;
   EXPECT_THROW(tuner.iteratePairwise(&functor, doRebuild), autopas::utils::ExceptionHandler::AutoPasException);
 }
+
+/**
+ * The second configuration is much slower than the first one and should be discarded after its first sample.
+ */
+TEST_F(AutoTunerTest, testEarlyStopping) {
+  autopas::Configuration fastConfig(autopas::ContainerOption::directSum, 1.,
+                                    autopas::TraversalOption::directSumTraversal, autopas::DataLayoutOption::aos,
+                                    autopas::Newton3Option::disabled);
+  autopas::Configuration slowConfig(autopas::ContainerOption::linkedCells, 1., autopas::TraversalOption::c08,
+                                    autopas::DataLayoutOption::aos, autopas::Newton3Option::disabled);
+
+  auto configsList = {fastConfig, slowConfig};
+  auto tuningStrategy = std::make_unique<autopas::FullSearch>(configsList);
+  const size_t maxSamples = 3;
+  autopas::AutoTuner<Particle, FPCell> tuner({0, 0, 0}, {10, 10, 10}, 1, std::move(tuningStrategy),
+                                             autopas::SelectorStrategyOption::fastestAbs, 1000, maxSamples, "",
+                                             /*earlyStoppingFactor*/ 2.);
+
+  Particle p1({1., 1., 1.}, {0., 0., 0.}, 0);
+  Particle p2({1.5, 1., 1.}, {0., 0., 0.}, 1);
+  tuner.getContainer()->addParticle(p1);
+  tuner.getContainer()->addParticle(p2);
+
+  MFunctor functor;
+  EXPECT_CALL(functor, isRelevantForTuning()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(functor, allowsNewton3()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(functor, allowsNonNewton3()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(functor, AoSFunctor(_, _, _)).WillRepeatedly(::testing::Invoke([&](Particle &, Particle &, bool) {
+    if (tuner.getCurrentConfig() == slowConfig) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+  }));
+
+  size_t tuningIterations = 0;
+  while (tuner.iteratePairwise(&functor, true)) {
+    ++tuningIterations;
+  }
+
+  EXPECT_EQ(tuningIterations, maxSamples + 1) << "The slow configuration should only be sampled once.";
+  EXPECT_EQ(tuner.getCurrentConfig(), fastConfig);
+}
+
+/**
+ * After the tuning phase the selected configuration becomes much slower, which should trigger a new tuning phase long
+ * before the tuning interval is over.
+ */
+TEST_F(AutoTunerTest, testDriftTriggersTuning) {
+  autopas::Configuration configDS(autopas::ContainerOption::directSum, 1., autopas::TraversalOption::directSumTraversal,
+                                  autopas::DataLayoutOption::aos, autopas::Newton3Option::disabled);
+  autopas::Configuration configLC(autopas::ContainerOption::linkedCells, 1., autopas::TraversalOption::c08,
+                                  autopas::DataLayoutOption::aos, autopas::Newton3Option::disabled);
+
+  auto configsList = {configDS, configLC};
+  auto tuningStrategy = std::make_unique<autopas::FullSearch>(configsList);
+  const unsigned int tuningInterval = 1000;
+  const unsigned int driftWindowSize = 3;
+  autopas::AutoTuner<Particle, FPCell> tuner({0, 0, 0}, {10, 10, 10}, 1, std::move(tuningStrategy),
+                                             autopas::SelectorStrategyOption::fastestAbs, tuningInterval, 1, "",
+                                             std::numeric_limits<double>::infinity(), /*driftThreshold*/ 3.,
+                                             driftWindowSize);
+
+  Particle p1({1., 1., 1.}, {0., 0., 0.}, 0);
+  Particle p2({1.5, 1., 1.}, {0., 0., 0.}, 1);
+  tuner.getContainer()->addParticle(p1);
+  tuner.getContainer()->addParticle(p2);
+
+  bool slowDown = false;
+  MFunctor functor;
+  EXPECT_CALL(functor, isRelevantForTuning()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(functor, allowsNewton3()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(functor, allowsNonNewton3()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(functor, AoSFunctor(_, _, _)).WillRepeatedly(::testing::Invoke([&](Particle &, Particle &, bool) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(slowDown ? 20 : 1));
+  }));
+
+  while (tuner.iteratePairwise(&functor, true)) {
+  }
+  // the first iteration after tuning already contributed to the baseline, fill the rest
+  for (unsigned int i = 1; i < driftWindowSize; ++i) {
+    EXPECT_FALSE(tuner.iteratePairwise(&functor, true));
+  }
+
+  slowDown = true;
+  size_t iterationsUntilTuning = 0;
+  while (not tuner.iteratePairwise(&functor, true) and iterationsUntilTuning < tuningInterval) {
+    ++iterationsUntilTuning;
+  }
+  EXPECT_EQ(iterationsUntilTuning, driftWindowSize) << "Drift should be detected once the recent window is full.";
+}
+
+/**
+ * With adaptive sampling the configuration with widely spread times is sampled until the cap, while the one with
+ * stable times only gets the minimal number of samples.
+ */
+TEST_F(AutoTunerTest, testAdaptiveSampling) {
+  autopas::Configuration noisyConfig(autopas::ContainerOption::directSum, 1.,
+                                     autopas::TraversalOption::directSumTraversal, autopas::DataLayoutOption::aos,
+                                     autopas::Newton3Option::disabled);
+  autopas::Configuration stableConfig(autopas::ContainerOption::linkedCells, 1., autopas::TraversalOption::c08,
+                                      autopas::DataLayoutOption::aos, autopas::Newton3Option::disabled);
+
+  auto configsList = {noisyConfig, stableConfig};
+  auto tuningStrategy = std::make_unique<autopas::FullSearch>(configsList);
+  const unsigned int numSamples = 3;
+  const unsigned int maxSamples = 6;
+  autopas::AutoTuner<Particle, FPCell> tuner(
+      {0, 0, 0}, {10, 10, 10}, 1, std::move(tuningStrategy), autopas::SelectorStrategyOption::fastestMean, 1000,
+      numSamples, "", std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity(), 10, {},
+      maxSamples, /*relativeConfidenceWidth*/ 0.2);
+
+  Particle p1({1., 1., 1.}, {0., 0., 0.}, 0);
+  Particle p2({1.5, 1., 1.}, {0., 0., 0.}, 1);
+  tuner.getContainer()->addParticle(p1);
+  tuner.getContainer()->addParticle(p2);
+
+  size_t iteration = 0;
+  MFunctor functor;
+  EXPECT_CALL(functor, isRelevantForTuning()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(functor, allowsNewton3()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(functor, allowsNonNewton3()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(functor, AoSFunctor(_, _, _)).WillRepeatedly(::testing::Invoke([&](Particle &, Particle &, bool) {
+    // noisy times are spread evenly between 1 and 10 ms, so no sample is rejected as outlier
+    const auto sleepTime = tuner.getCurrentConfig() == noisyConfig ? 1 + 3 * (iteration % 4) : 20;
+    std::this_thread::sleep_for(std::chrono::milliseconds(sleepTime));
+  }));
+
+  size_t tuningIterations = 0;
+  while (tuner.iteratePairwise(&functor, true)) {
+    ++tuningIterations;
+    ++iteration;
+  }
+
+  EXPECT_EQ(tuningIterations, maxSamples + numSamples);
+}
+
+/**
+ * The traversal has to run with the number of threads of the configuration. Configurations that request more threads
+ * than available are not applicable.
+ */
+TEST_F(AutoTunerTest, testNumThreads) {
+  const auto maxThreads = static_cast<unsigned int>(autopas::autopas_get_max_threads());
+  autopas::Configuration oneThreadConfig(autopas::ContainerOption::linkedCells, 1., autopas::TraversalOption::c08,
+                                         autopas::DataLayoutOption::aos, autopas::Newton3Option::disabled, 0., 1, 1,
+                                         autopas::ScheduleOption::staticSchedule, 0);
+  autopas::Configuration tooManyThreadsConfig(autopas::ContainerOption::linkedCells, 1., autopas::TraversalOption::c08,
+                                              autopas::DataLayoutOption::aos, autopas::Newton3Option::disabled, 0., 1,
+                                              maxThreads + 1);
+
+  auto configsList = {oneThreadConfig, tooManyThreadsConfig};
+  auto tuningStrategy = std::make_unique<autopas::FullSearch>(configsList);
+  autopas::AutoTuner<Particle, FPCell> tuner({0, 0, 0}, {10, 10, 10}, 1, std::move(tuningStrategy),
+                                             autopas::SelectorStrategyOption::fastestAbs, 1000, 3);
+
+  Particle p1({1., 1., 1.}, {0., 0., 0.}, 0);
+  Particle p2({1.5, 1., 1.}, {0., 0., 0.}, 1);
+  tuner.getContainer()->addParticle(p1);
+  tuner.getContainer()->addParticle(p2);
+
+  MFunctor functor;
+  EXPECT_CALL(functor, isRelevantForTuning()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(functor, allowsNewton3()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(functor, allowsNonNewton3()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(functor, AoSFunctor(_, _, _)).WillRepeatedly(::testing::Invoke([](Particle &, Particle &, bool) {
+    EXPECT_EQ(autopas::autopas_get_num_threads(), 1);
+  }));
+
+  for (int i = 0; i < 4; ++i) {
+    tuner.iteratePairwise(&functor, true);
+    EXPECT_EQ(tuner.getCurrentConfig(), oneThreadConfig);
+    // settings of the application are restored after the traversal
+    EXPECT_EQ(autopas::autopas_get_max_threads(), maxThreads);
+  }
+}
+
+/**
+ * Two functor types prefer different traversals. With independent tuning both should end up with their own optimum
+ * on the same container.
+ */
+TEST_F(AutoTunerTest, testTuneFunctorsIndependently) {
+  // a distinct type so the tuner can tell the functors apart
+  class OtherMFunctor : public MFunctor {};
+
+  autopas::Configuration c08Config(autopas::ContainerOption::linkedCells, 1., autopas::TraversalOption::c08,
+                                   autopas::DataLayoutOption::aos, autopas::Newton3Option::disabled);
+  autopas::Configuration c18Config(autopas::ContainerOption::linkedCells, 1., autopas::TraversalOption::c18,
+                                   autopas::DataLayoutOption::aos, autopas::Newton3Option::disabled);
+
+  auto configsList = {c08Config, c18Config};
+  auto tuningStrategy = std::make_unique<autopas::FullSearch>(configsList);
+  autopas::AutoTuner<Particle, FPCell> tuner(
+      {0, 0, 0}, {10, 10, 10}, 1, std::move(tuningStrategy), autopas::SelectorStrategyOption::fastestAbs, 1000, 3,
+      "", std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity(), 10, {}, 0,
+      std::numeric_limits<double>::infinity(), "", /*tuneFunctorsIndependently*/ true);
+
+  Particle p1({1., 1., 1.}, {0., 0., 0.}, 0);
+  Particle p2({1.5, 1., 1.}, {0., 0., 0.}, 1);
+  tuner.getContainer()->addParticle(p1);
+  tuner.getContainer()->addParticle(p2);
+
+  MFunctor leadingFunctor;
+  EXPECT_CALL(leadingFunctor, isRelevantForTuning()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(leadingFunctor, allowsNewton3()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(leadingFunctor, allowsNonNewton3()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(leadingFunctor, AoSFunctor(_, _, _)).WillRepeatedly(::testing::Invoke([&](Particle &, Particle &, bool) {
+    if (tuner.getCurrentConfig() == c18Config) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+  }));
+
+  OtherMFunctor otherFunctor;
+  EXPECT_CALL(otherFunctor, isRelevantForTuning()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(otherFunctor, allowsNewton3()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(otherFunctor, allowsNonNewton3()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(otherFunctor, AoSFunctor(_, _, _)).WillRepeatedly(::testing::Invoke([&](Particle &, Particle &, bool) {
+    if (tuner.getFunctorConfig<OtherMFunctor>() == c08Config) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+  }));
+
+  for (int i = 0; i < 20; ++i) {
+    const bool leaderTuned = tuner.iteratePairwise(&leadingFunctor, true);
+    tuner.iteratePairwise(&otherFunctor, true);
+    if (leaderTuned) {
+      // while the leading functor tunes, the other functor follows it
+      EXPECT_EQ(tuner.getFunctorConfig<OtherMFunctor>(), tuner.getCurrentConfig());
+    }
+  }
+
+  EXPECT_EQ(tuner.getCurrentConfig(), c08Config);
+  EXPECT_EQ(tuner.getFunctorConfig<MFunctor>(), c08Config);
+  EXPECT_EQ(tuner.getFunctorConfig<OtherMFunctor>(), c18Config);
+}
+
+/**
+ * With proxy tuning all configurations are measured on a part of the domain first. Only the fastest ones are sampled on
+ * the full domain.
+ */
+TEST_F(AutoTunerTest, testProxyDomainTuning) {
+  autopas::Configuration c08Config(autopas::ContainerOption::linkedCells, 1., autopas::TraversalOption::c08,
+                                   autopas::DataLayoutOption::aos, autopas::Newton3Option::disabled);
+  autopas::Configuration c18Config(autopas::ContainerOption::linkedCells, 1., autopas::TraversalOption::c18,
+                                   autopas::DataLayoutOption::aos, autopas::Newton3Option::disabled);
+  autopas::Configuration c01Config(autopas::ContainerOption::linkedCells, 1., autopas::TraversalOption::c01,
+                                   autopas::DataLayoutOption::aos, autopas::Newton3Option::disabled);
+
+  auto configsList = {c08Config, c18Config, c01Config};
+  auto tuningStrategy = std::make_unique<autopas::FullSearch>(configsList);
+  const size_t numSamples = 3;
+  const unsigned int numProxyConfirmations = 2;
+  autopas::AutoTuner<Particle, FPCell> tuner(
+      {0, 0, 0}, {10, 10, 10}, 1, std::move(tuningStrategy), autopas::SelectorStrategyOption::fastestAbs, 1000,
+      numSamples, "", std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity(), 10, {}, 0,
+      std::numeric_limits<double>::infinity(), "", /*tuneFunctorsIndependently*/ false, /*proxyDomainFraction*/ 0.125,
+      numProxyConfirmations);
+
+  // both particles lie in the proxy domain, which is the centered box with half the side length
+  Particle p1({5., 5., 5.}, {0., 0., 0.}, 0);
+  Particle p2({5.5, 5., 5.}, {0., 0., 0.}, 1);
+  tuner.getContainer()->addParticle(p1);
+  tuner.getContainer()->addParticle(p2);
+
+  MFunctor functor;
+  EXPECT_CALL(functor, isRelevantForTuning()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(functor, allowsNewton3()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(functor, allowsNonNewton3()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(functor, AoSFunctor(_, _, _)).WillRepeatedly(::testing::Invoke([&](Particle &, Particle &, bool) {
+    if (tuner.getCurrentConfig() == c01Config) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+  }));
+
+  std::set<autopas::Configuration> sampledConfigs;
+  size_t numTuningIterations = 0;
+  while (tuner.iteratePairwise(&functor, true)) {
+    sampledConfigs.insert(tuner.getCurrentConfig());
+    ++numTuningIterations;
+  }
+
+  // the slow configuration is only measured on the proxy domain
+  EXPECT_EQ(sampledConfigs, (std::set<autopas::Configuration>{c08Config, c18Config}));
+  EXPECT_EQ(numTuningIterations, numProxyConfirmations * numSamples);
+  EXPECT_NE(tuner.getCurrentConfig(), c01Config);
+}
+
+/**
+ * With performance counters every measured configuration gets counter evidence if the counters are available.
+ * Otherwise the tuner falls back to timings only.
+ */
+TEST_F(AutoTunerTest, testPerformanceCounters) {
+  autopas::Configuration c08Config(autopas::ContainerOption::linkedCells, 1., autopas::TraversalOption::c08,
+                                   autopas::DataLayoutOption::aos, autopas::Newton3Option::disabled);
+  autopas::Configuration c18Config(autopas::ContainerOption::linkedCells, 1., autopas::TraversalOption::c18,
+                                   autopas::DataLayoutOption::aos, autopas::Newton3Option::disabled);
+
+  auto configsList = {c08Config, c18Config};
+  auto tuningStrategy = std::make_unique<autopas::FullSearch>(configsList);
+  autopas::AutoTuner<Particle, FPCell> tuner(
+      {0, 0, 0}, {10, 10, 10}, 1, std::move(tuningStrategy), autopas::SelectorStrategyOption::fastestAbs, 1000, 2, "",
+      std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity(), 10, {}, 0,
+      std::numeric_limits<double>::infinity(), "", /*tuneFunctorsIndependently*/ false, /*proxyDomainFraction*/ 1.,
+      /*numProxyConfirmations*/ 3, /*usePerformanceCounters*/ true);
+
+  Particle p1({1., 1., 1.}, {0., 0., 0.}, 0);
+  Particle p2({1.5, 1., 1.}, {0., 0., 0.}, 1);
+  tuner.getContainer()->addParticle(p1);
+  tuner.getContainer()->addParticle(p2);
+
+  MFunctor functor;
+  EXPECT_CALL(functor, isRelevantForTuning()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(functor, allowsNewton3()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(functor, allowsNonNewton3()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(functor, AoSFunctor(_, _, _)).Times(::testing::AtLeast(1));
+
+  for (int i = 0; i < 5; ++i) {
+    tuner.iteratePairwise(&functor, true);
+  }
+
+  const auto &evidence = tuner.getPerformanceCounterEvidence();
+  if (autopas::utils::PerformanceCounters().isAvailable()) {
+    ASSERT_EQ(evidence.size(), 2);
+    for (const auto &config : configsList) {
+      EXPECT_EQ(evidence.at(config).numMeasurements, 2);
+      EXPECT_GT(evidence.at(config).instructions, 0.);
+    }
+  } else {
+    EXPECT_TRUE(evidence.empty());
+  }
+}
@@ -31,6 +31,63 @@ TEST_F(ContainerSelectorTest, testSelectAndGetCurrentContainer) {
   }
 }
 
+/**
+ * Checks that the cluster based containers are built with the cluster size of the container info.
+ */
+TEST_F(ContainerSelectorTest, testClusterSizeIsPassedToContainer) {
+  std::array<double, 3> bBoxMin = {0, 0, 0}, bBoxMax = {10, 10, 10};
+  const double cutoff = 1;
+  const unsigned int clusterSize = 8;
+
+  autopas::ContainerSelector<Particle, FPCell> containerSelector(bBoxMin, bBoxMax, cutoff);
+  autopas::ContainerSelectorInfo containerInfo(1., 0., clusterSize);
+
+  for (autopas::ContainerOption containerOp :
+       {autopas::ContainerOption::verletClusterLists, autopas::ContainerOption::verletClusterCells}) {
+    containerSelector.selectContainer(containerOp, containerInfo);
+    EXPECT_EQ(containerSelector.getCurrentContainer()->getTraversalSelectorInfo().clusterSize, clusterSize)
+        << containerOp.to_string();
+  }
+}
+
+/**
+ * Checks that the traversal info derived without building a container matches the one of the actual container.
+ * Only containers whose cell structure is fixed at construction are compared, since the cluster based containers only
+ * know their grid after the first rebuild.
+ */
+TEST_F(ContainerSelectorTest, testGetTraversalSelectorInfoWithoutContainer) {
+  const std::array<double, 3> bBoxMin = {0, 0, 0}, bBoxMax = {10, 7.5, 5};
+  const double cutoff = 1;
+  const double verletSkin = 0.2;
+
+  const std::vector<autopas::ContainerOption> containerOptions = {
+      autopas::ContainerOption::directSum, autopas::ContainerOption::linkedCells, autopas::ContainerOption::verletLists,
+      autopas::ContainerOption::verletListsCells, autopas::ContainerOption::varVerletListsAsBuild};
+
+  for (auto containerOp : containerOptions) {
+    for (double cellSizeFactor : {0.5, 1., 1.3}) {
+      autopas::ContainerSelectorInfo containerInfo(cellSizeFactor, verletSkin, 64);
+
+      autopas::ContainerSelector<Particle, FPCell> derivingSelector(bBoxMin, bBoxMax, cutoff);
+      auto derivedInfo = derivingSelector.getTraversalSelectorInfo(containerOp, containerInfo);
+
+      autopas::ContainerSelector<Particle, FPCell> buildingSelector(bBoxMin, bBoxMax, cutoff);
+      buildingSelector.selectContainer(containerOp, containerInfo);
+      auto actualInfo = buildingSelector.getCurrentContainer()->getTraversalSelectorInfo();
+
+      EXPECT_EQ(derivedInfo.dims, actualInfo.dims) << containerOp.to_string() << " csf: " << cellSizeFactor;
+      EXPECT_DOUBLE_EQ(derivedInfo.interactionLength, actualInfo.interactionLength)
+          << containerOp.to_string() << " csf: " << cellSizeFactor;
+      for (size_t d = 0; d < 3; ++d) {
+        EXPECT_DOUBLE_EQ(derivedInfo.cellLength[d], actualInfo.cellLength[d])
+            << containerOp.to_string() << " csf: " << cellSizeFactor;
+      }
+      EXPECT_EQ(derivedInfo.clusterSize, actualInfo.clusterSize)
+          << containerOp.to_string() << " csf: " << cellSizeFactor;
+    }
+  }
+}
+
 /**
  * This function stores a copy of each particle depending on the position in ListInner, ListHalo or ListHaloVerletOnly.
  * @param bBoxMin Bounding box min.
@@ -0,0 +1,56 @@
+/**
+ * @file DriftMonitorTest.cpp
+ * @author F. Gratl
+ * @date 16.10.26
+ */
+
+#include "DriftMonitorTest.h"
+
+#include "autopas/selectors/DriftMonitor.h"
+
+TEST_F(DriftMonitorTest, testNoDriftOnNoise) {
+  autopas::DriftMonitor monitor(3., 4);
+  for (long time : {100, 104, 96, 100, 102, 98, 101, 99, 103, 97}) {
+    monitor.addMeasurement(time);
+    EXPECT_FALSE(monitor.driftDetected());
+  }
+}
+
+TEST_F(DriftMonitorTest, testDrift) {
+  autopas::DriftMonitor monitor(3., 4);
+  for (long time : {100, 104, 96, 100}) {
+    monitor.addMeasurement(time);
+  }
+  EXPECT_DOUBLE_EQ(monitor.getBaselineMean(), 100.);
+
+  // the recent window is not full yet
+  for (long time : {200, 200, 200}) {
+    monitor.addMeasurement(time);
+    EXPECT_FALSE(monitor.driftDetected());
+  }
+  monitor.addMeasurement(200);
+  EXPECT_TRUE(monitor.driftDetected());
+
+  monitor.reset();
+  EXPECT_FALSE(monitor.driftDetected());
+}
+
+TEST_F(DriftMonitorTest, testDriftToFaster) {
+  autopas::DriftMonitor monitor(3., 2);
+  for (long time : {100, 100, 10, 10}) {
+    monitor.addMeasurement(time);
+  }
+  EXPECT_TRUE(monitor.driftDetected());
+}
+
+TEST_F(DriftMonitorTest, testMinRelativeDeviation) {
+  // a perfectly stable baseline would otherwise report every tiny change as drift
+  autopas::DriftMonitor monitor(1., 2, 0.05);
+  for (long time : {100, 100, 104, 104}) {
+    monitor.addMeasurement(time);
+  }
+  EXPECT_FALSE(monitor.driftDetected());
+  monitor.addMeasurement(106);
+  monitor.addMeasurement(106);
+  EXPECT_TRUE(monitor.driftDetected());
+}
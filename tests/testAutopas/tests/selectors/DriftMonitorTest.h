@@ -0,0 +1,13 @@
+/**
+ * @file DriftMonitorTest.h
+ * @author F. Gratl
+ * @date 16.10.26
+ */
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "AutoPasTestBase.h"
+
+class DriftMonitorTest : public AutoPasTestBase {};
@@ -17,7 +17,9 @@ TEST_F(FeatureVectorTest, lhsSample) {
 
   auto vecList = autopas::FeatureVector::lhsSampleFeatures(
       n, rand, autopas::NumberInterval<double>(1., 2.), autopas::TraversalOption::getAllOptions(),
-      autopas::DataLayoutOption::getAllOptions(), autopas::Newton3Option::getAllOptions());
+      autopas::DataLayoutOption::getAllOptions(), autopas::Newton3Option::getAllOptions(),
+      autopas::NumberInterval<double>(0., .5), {1, 5, 10}, {0, 2, 4}, autopas::ScheduleOption::getAllOptions(),
+      {1, 16}, {4, 8});
 
   EXPECT_EQ(vecList.size(), n);
 }
@@ -51,13 +53,20 @@ TEST_F(FeatureVectorTest, distanceTest) {
 
   EXPECT_EQ(static_cast<Eigen::VectorXd>(f1 - f4).squaredNorm(), 3);
   EXPECT_EQ(static_cast<Eigen::VectorXd>(f4 - f1).squaredNorm(), 3);
+
+  autopas::FeatureVector f5(ContainerOption::linkedCells, 1., TraversalOption::c08, DataLayoutOption::soa,
+                            Newton3Option::disabled, 0., 1, 0, ScheduleOption::guidedSchedule);
+  EXPECT_EQ(static_cast<Eigen::VectorXd>(f4 - f5).squaredNorm(), 1);
+  EXPECT_EQ(static_cast<Eigen::VectorXd>(f5 - f4).squaredNorm(), 1);
 }
 
 TEST_F(FeatureVectorTest, onehot) {
   autopas::Random rand(42);
   auto vecList = autopas::FeatureVector::lhsSampleFeatures(
       100, rand, autopas::NumberInterval<double>(1., 2.), autopas::TraversalOption::getAllOptions(),
-      autopas::DataLayoutOption::getAllOptions(), autopas::Newton3Option::getAllOptions());
+      autopas::DataLayoutOption::getAllOptions(), autopas::Newton3Option::getAllOptions(),
+      autopas::NumberInterval<double>(0., .5), {1, 5, 10}, {0, 2, 4}, autopas::ScheduleOption::getAllOptions(),
+      {1, 16}, {4, 8});
 
   for (auto fv : vecList) {
     auto vec = fv.oneHotEncode();
@@ -31,3 +31,30 @@ TEST(OptimumSelectorTest, median) {
 
   EXPECT_EQ(5, median);
 }
+
+TEST(OptimumSelectorTest, rejectOutliers) {
+  std::vector<unsigned long> vals = {100, 103, 98, 1000, 101};
+
+  auto inliers = autopas::OptimumSelector::rejectOutliers(vals);
+
+  EXPECT_EQ(inliers, (std::vector<unsigned long>{100, 103, 98, 101}));
+}
+
+TEST(OptimumSelectorTest, rejectOutliersStable) {
+  // without a lower bound for the deviation every value apart from the median would be rejected
+  std::vector<unsigned long> vals = {100, 100, 100, 101, 99};
+
+  auto inliers = autopas::OptimumSelector::rejectOutliers(vals);
+
+  EXPECT_EQ(inliers, vals);
+}
+
+TEST(OptimumSelectorTest, relativeConfidenceIntervalWidth) {
+  EXPECT_TRUE(std::isinf(autopas::OptimumSelector::relativeConfidenceIntervalWidth({5})));
+  EXPECT_DOUBLE_EQ(autopas::OptimumSelector::relativeConfidenceIntervalWidth({5, 5, 5}), 0.);
+
+  // mean 100, standard deviation 10, t-quantile for three degrees of freedom 3.182
+  std::vector<unsigned long> vals = {90, 110, 90, 110};
+  EXPECT_NEAR(autopas::OptimumSelector::relativeConfidenceIntervalWidth(vals), 3.182 * (20. / std::sqrt(3.)) / 2. / 100.,
+              1e-12);
+}
@@ -0,0 +1,113 @@
+/**
+ * @file RuleBasedPruningTest.cpp
+ * @author F. Gratl
+ * @date 16.10.26
+ */
+
+#include "RuleBasedPruningTest.h"
+
+#include "autopas/containers/linkedCells/LinkedCells.h"
+#include "autopas/selectors/AutoTuner.h"
+#include "autopas/selectors/RuleBasedPruning.h"
+#include "autopas/selectors/tuningStrategy/FullSearch.h"
+
+using ::testing::_;
+
+TEST_F(RuleBasedPruningTest, testCollectStatistics) {
+  autopas::LinkedCells<FPCell> linkedCells({0., 0., 0.}, {4., 4., 4.}, 1., 0., 1.);
+  // two particles in the first and two in the last of the 64 statistic cells
+  for (auto &pos : std::vector<std::array<double, 3>>{{.1, .1, .1}, {.5, .5, .5}, {3.5, 3.5, 3.5}, {3.9, 3.9, 3.9}}) {
+    Particle p(pos, {0., 0., 0.}, 0);
+    linkedCells.addParticle(p);
+  }
+
+  auto statistics = autopas::DomainStatistics::collect(linkedCells, 4);
+  EXPECT_EQ(statistics.numParticles, 4);
+  EXPECT_EQ(statistics.numThreads, 4);
+  EXPECT_DOUBLE_EQ(statistics.meanParticlesPerCell, 4. / 64.);
+  EXPECT_DOUBLE_EQ(statistics.particlesPerCellVariance, 8. / 64. - (4. / 64.) * (4. / 64.));
+}
+
+TEST_F(RuleBasedPruningTest, testDefaultRules) {
+  autopas::RuleBasedPruning pruning(autopas::RuleBasedPruning::getDefaultRules());
+  autopas::Configuration directSum(autopas::ContainerOption::directSum, 1.,
+                                   autopas::TraversalOption::directSumTraversal, autopas::DataLayoutOption::soa,
+                                   autopas::Newton3Option::enabled);
+  autopas::Configuration c18(autopas::ContainerOption::linkedCells, 1., autopas::TraversalOption::c18,
+                             autopas::DataLayoutOption::soa, autopas::Newton3Option::enabled);
+
+  autopas::DomainStatistics statistics;
+  statistics.numParticles = 100;
+  statistics.numThreads = 4;
+  pruning.setStatistics(statistics);
+  EXPECT_EQ(pruning.findPruningRule(directSum), nullptr);
+  EXPECT_EQ(pruning.findPruningRule(c18), nullptr);
+
+  statistics.numParticles = 10000;
+  pruning.setStatistics(statistics);
+  EXPECT_NE(pruning.findPruningRule(directSum), nullptr);
+  EXPECT_EQ(pruning.findPruningRule(c18), nullptr);
+
+  statistics.numThreads = 64;
+  pruning.setStatistics(statistics);
+  EXPECT_NE(pruning.findPruningRule(c18), nullptr);
+}
+
+TEST_F(RuleBasedPruningTest, testRuleMatchesPattern) {
+  autopas::PruningRule rule{"test",
+                            {autopas::ContainerOption::linkedCells},
+                            {},
+                            {},
+                            {autopas::Newton3Option::disabled},
+                            [](const autopas::DomainStatistics &) { return true; }};
+
+  EXPECT_TRUE(rule.matches(autopas::Configuration(autopas::ContainerOption::linkedCells, 1.,
+                                                  autopas::TraversalOption::c08, autopas::DataLayoutOption::aos,
+                                                  autopas::Newton3Option::disabled)));
+  EXPECT_FALSE(rule.matches(autopas::Configuration(autopas::ContainerOption::linkedCells, 1.,
+                                                   autopas::TraversalOption::c08, autopas::DataLayoutOption::aos,
+                                                   autopas::Newton3Option::enabled)));
+  EXPECT_FALSE(rule.matches(autopas::Configuration(autopas::ContainerOption::directSum, 1.,
+                                                   autopas::TraversalOption::directSumTraversal,
+                                                   autopas::DataLayoutOption::aos, autopas::Newton3Option::disabled)));
+}
+
+/**
+ * The AutoTuner should never sample configurations that are pruned.
+ */
+TEST_F(RuleBasedPruningTest, testAutoTunerSkipsPrunedConfigurations) {
+  autopas::Configuration configDS(autopas::ContainerOption::directSum, 1., autopas::TraversalOption::directSumTraversal,
+                                  autopas::DataLayoutOption::aos, autopas::Newton3Option::disabled);
+  autopas::Configuration configLC(autopas::ContainerOption::linkedCells, 1., autopas::TraversalOption::c08,
+                                  autopas::DataLayoutOption::aos, autopas::Newton3Option::disabled);
+
+  std::vector<autopas::PruningRule> rules{{"no directSum with particles",
+                                           {autopas::ContainerOption::directSum},
+                                           {},
+                                           {},
+                                           {},
+                                           [](const autopas::DomainStatistics &statistics) {
+                                             return statistics.numParticles > 0;
+                                           }}};
+  const unsigned int maxSamples = 2;
+  autopas::AutoTuner<Particle, FPCell> tuner({0, 0, 0}, {10, 10, 10}, 1,
+                                             std::make_unique<autopas::FullSearch>(std::set{configDS, configLC}),
+                                             autopas::SelectorStrategyOption::fastestAbs, 1000, maxSamples, "",
+                                             std::numeric_limits<double>::infinity(),
+                                             std::numeric_limits<double>::infinity(), 10, rules);
+  Particle p({1., 1., 1.}, {0., 0., 0.}, 0);
+  tuner.getContainer()->addParticle(p);
+
+  MockFunctor<Particle, FPCell> functor;
+  EXPECT_CALL(functor, isRelevantForTuning()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(functor, allowsNewton3()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(functor, allowsNonNewton3()).WillRepeatedly(::testing::Return(true));
+
+  size_t tuningIterations = 0;
+  while (tuner.iteratePairwise(&functor, true)) {
+    EXPECT_EQ(tuner.getCurrentConfig(), configLC);
+    ++tuningIterations;
+  }
+  EXPECT_EQ(tuningIterations, maxSamples);
+  EXPECT_EQ(tuner.getCurrentConfig(), configLC);
+}
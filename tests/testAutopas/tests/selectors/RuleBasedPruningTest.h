@@ -0,0 +1,14 @@
+/**
+ * @file RuleBasedPruningTest.h
+ * @author F. Gratl
+ * @date 16.10.26
+ */
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "AutoPasTestBase.h"
+#include "testingHelpers/commonTypedefs.h"
+
+class RuleBasedPruningTest : public AutoPasTestBase {};
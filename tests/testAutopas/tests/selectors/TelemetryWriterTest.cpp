@@ -0,0 +1,81 @@
+/**
+ * @file TelemetryWriterTest.cpp
+ * @author F. Gratl
+ * @date 17.10.26
+ */
+
+#include "TelemetryWriterTest.h"
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "autopas/selectors/TelemetryWriter.h"
+
+namespace {
+std::vector<std::string> readLines(const std::string &filename) {
+  std::ifstream in(filename);
+  std::vector<std::string> lines;
+  std::string line;
+  while (std::getline(in, line)) {
+    lines.push_back(line);
+  }
+  return lines;
+}
+
+autopas::IterationTelemetry makeTelemetry(size_t iteration) {
+  autopas::IterationTelemetry telemetry;
+  telemetry.iteration = iteration;
+  telemetry.configuration =
+      autopas::Configuration(autopas::ContainerOption::linkedCells, 1., autopas::TraversalOption::c08,
+                             autopas::DataLayoutOption::soa, autopas::Newton3Option::enabled);
+  telemetry.isTuning = iteration == 0;
+  telemetry.containerUpdateTime = 1;
+  telemetry.rebuildTime = 2;
+  telemetry.soaLoadTime = 3;
+  telemetry.traversalTime = 4;
+  telemetry.soaExtractTime = 5;
+  telemetry.numParticlesOwned = 100;
+  telemetry.numParticlesHalo = 20;
+  return telemetry;
+}
+}  // namespace
+
+/**
+ * More records than fit into the buffer have to end up in the file in order after the writer is destroyed.
+ */
+TEST_F(TelemetryWriterTest, testCsv) {
+  const size_t numRecords = 10;
+  {
+    autopas::TelemetryWriter writer(_filename, autopas::TelemetryFormatOption::csv, 3);
+    for (size_t i = 0; i < numRecords; ++i) {
+      writer.record(makeTelemetry(i));
+    }
+  }
+
+  const auto lines = readLines(_filename);
+  ASSERT_EQ(lines.size(), numRecords + 1);
+  EXPECT_EQ(lines[0], autopas::TelemetryWriter::getCsvHeader());
+  EXPECT_EQ(lines[1], "0,LinkedCells,1,c08,SoA,enabled,0,1,0,dynamic,1,4,1,1,2,3,4,5,100,20");
+  for (size_t i = 0; i < numRecords; ++i) {
+    EXPECT_EQ(lines[i + 1].substr(0, lines[i + 1].find(',')), std::to_string(i));
+  }
+}
+
+TEST_F(TelemetryWriterTest, testJsonLines) {
+  {
+    autopas::TelemetryWriter writer(_filename, autopas::TelemetryFormatOption::jsonLines);
+    writer.record(makeTelemetry(0));
+    writer.record(makeTelemetry(1));
+  }
+
+  const auto lines = readLines(_filename);
+  ASSERT_EQ(lines.size(), 2);
+  EXPECT_EQ(lines[0],
+            "{\"iteration\":0,\"container\":\"LinkedCells\",\"cellSizeFactor\":1,\"traversal\":\"c08\","
+            "\"dataLayout\":\"SoA\",\"newton3\":\"enabled\",\"verletSkin\":0,\"verletRebuildFrequency\":1,"
+            "\"numThreads\":0,\"schedule\":\"dynamic\",\"scheduleChunkSize\":1,\"verletClusterSize\":4,"
+            "\"isTuning\":true,\"containerUpdateTime\":1,\"rebuildTime\":2,\"soaLoadTime\":3,\"traversalTime\":4,"
+            "\"soaExtractTime\":5,\"numParticlesOwned\":100,\"numParticlesHalo\":20}");
+  EXPECT_NE(lines[1].find("\"isTuning\":false"), std::string::npos);
+}
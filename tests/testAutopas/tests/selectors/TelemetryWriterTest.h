@@ -0,0 +1,20 @@
+/**
+ * @file TelemetryWriterTest.h
+ * @author F. Gratl
+ * @date 17.10.26
+ */
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "AutoPasTestBase.h"
+
+class TelemetryWriterTest : public AutoPasTestBase {
+ public:
+  TelemetryWriterTest() = default;
+  ~TelemetryWriterTest() override { std::remove(_filename.c_str()); }
+
+ protected:
+  const std::string _filename{"telemetryWriterTest.txt"};
+};
@@ -0,0 +1,83 @@
+/**
+ * @file TuningDatabaseTest.cpp
+ * @author F. Gratl
+ * @date 16.10.26
+ */
+
+#include "TuningDatabaseTest.h"
+
+#include "autopas/selectors/AutoTuner.h"
+#include "autopas/selectors/TuningDatabase.h"
+#include "autopas/selectors/tuningStrategy/FullSearch.h"
+
+TEST_F(TuningDatabaseTest, testStoreAndLoad) {
+  autopas::ScenarioFingerprint fingerprint({0, 0, 0}, {10, 10, 10}, 1., 1000, 4, "functor");
+  autopas::Configuration configuration(autopas::ContainerOption::linkedCells, 1. / 3., autopas::TraversalOption::c08,
+                                       autopas::DataLayoutOption::soa, autopas::Newton3Option::enabled, 0.2, 10, 2,
+                                       autopas::ScheduleOption::guidedSchedule, 4, 8);
+  {
+    autopas::TuningDatabase database(_filename);
+    EXPECT_FALSE(database.lookup(fingerprint));
+    database.store(fingerprint, configuration);
+  }
+
+  autopas::TuningDatabase database(_filename);
+  EXPECT_EQ(database.size(), 1);
+  auto storedConfiguration = database.lookup(fingerprint);
+  ASSERT_TRUE(storedConfiguration);
+  EXPECT_EQ(*storedConfiguration, configuration);
+}
+
+TEST_F(TuningDatabaseTest, testFingerprintBuckets) {
+  autopas::ScenarioFingerprint reference({0, 0, 0}, {10, 10, 10}, 1., 1000, 4, "functor");
+  autopas::ScenarioFingerprint similar({0, 0, 0}, {10, 10, 10}, 1., 1020, 4, "functor");
+  autopas::ScenarioFingerprint moreParticles({0, 0, 0}, {10, 10, 10}, 1., 4000, 4, "functor");
+  autopas::ScenarioFingerprint moreThreads({0, 0, 0}, {10, 10, 10}, 1., 1000, 8, "functor");
+  autopas::ScenarioFingerprint otherFunctor({0, 0, 0}, {10, 10, 10}, 1., 1000, 4, "otherFunctor");
+  autopas::ScenarioFingerprint otherBox({0, 0, 0}, {20, 10, 5}, 1., 1000, 4, "functor");
+
+  EXPECT_EQ(reference.toString(), similar.toString());
+  EXPECT_NE(reference.toString(), moreParticles.toString());
+  EXPECT_NE(reference.toString(), moreThreads.toString());
+  EXPECT_NE(reference.toString(), otherFunctor.toString());
+  EXPECT_NE(reference.toString(), otherBox.toString());
+}
+
+/**
+ * Run one full tuning phase, then check that a second tuner with the same database skips tuning and starts with the
+ * stored optimum.
+ */
+TEST_F(TuningDatabaseTest, testWarmStartAutoTuner) {
+  std::set<autopas::Configuration> configs;
+  configs.emplace(autopas::ContainerOption::directSum, 1., autopas::TraversalOption::directSumTraversal,
+                  autopas::DataLayoutOption::aos, autopas::Newton3Option::disabled);
+  configs.emplace(autopas::ContainerOption::linkedCells, 1., autopas::TraversalOption::c08,
+                  autopas::DataLayoutOption::aos, autopas::Newton3Option::disabled);
+  configs.emplace(autopas::ContainerOption::linkedCells, 1., autopas::TraversalOption::c08,
+                  autopas::DataLayoutOption::aos, autopas::Newton3Option::enabled);
+
+  MFunctor functor;
+  EXPECT_CALL(functor, isRelevantForTuning()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(functor, allowsNewton3()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(functor, allowsNonNewton3()).WillRepeatedly(::testing::Return(true));
+
+  autopas::Configuration optimum;
+  {
+    autopas::AutoTuner<Particle, FPCell> autoTuner({0, 0, 0}, {10, 10, 10}, 1,
+                                                   std::make_unique<autopas::FullSearch>(configs),
+                                                   autopas::SelectorStrategyOption::fastestAbs, 1000, 1, _filename);
+    size_t iterations = 0;
+    while (autoTuner.iteratePairwise(&functor, true)) {
+      ++iterations;
+    }
+    EXPECT_EQ(iterations, configs.size());
+    optimum = autoTuner.getCurrentConfig();
+  }
+
+  autopas::AutoTuner<Particle, FPCell> autoTuner({0, 0, 0}, {10, 10, 10}, 1,
+                                                 std::make_unique<autopas::FullSearch>(configs),
+                                                 autopas::SelectorStrategyOption::fastestAbs, 1000, 1, _filename);
+  EXPECT_FALSE(autoTuner.iteratePairwise(&functor, true)) << "Tuning phase should be skipped.";
+  EXPECT_EQ(autoTuner.getCurrentConfig(), optimum);
+  EXPECT_FALSE(autoTuner.willRebuild());
+}
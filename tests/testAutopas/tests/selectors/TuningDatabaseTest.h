@@ -0,0 +1,21 @@
+/**
+ * @file TuningDatabaseTest.h
+ * @author F. Gratl
+ * @date 16.10.26
+ */
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "AutoPasTestBase.h"
+#include "testingHelpers/commonTypedefs.h"
+
+class TuningDatabaseTest : public AutoPasTestBase {
+ public:
+  TuningDatabaseTest() = default;
+  ~TuningDatabaseTest() override { std::remove(_filename.c_str()); }
+
+ protected:
+  const std::string _filename{"tuningDatabaseTest.txt"};
+};
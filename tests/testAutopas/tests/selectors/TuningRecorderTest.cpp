@@ -0,0 +1,60 @@
+/**
+ * @file TuningRecorderTest.cpp
+ * @author F. Gratl
+ * @date 16.10.26
+ */
+
+#include "TuningRecorderTest.h"
+
+#include "autopas/selectors/TuningRecorder.h"
+#include "autopas/selectors/tuningStrategy/FullSearch.h"
+#include "autopasTools/tuningReplay/TuningReplay.h"
+
+TEST_F(TuningRecorderTest, testRecordAndRead) {
+  autopas::Configuration configuration(autopas::ContainerOption::linkedCells, 1. / 3., autopas::TraversalOption::c08,
+                                       autopas::DataLayoutOption::soa, autopas::Newton3Option::enabled, 0.2, 10);
+  {
+    autopas::TuningRecorder recorder(_filename);
+    recorder.record({42, configuration, 1000, 15, {10, 12, 11}, {50}});
+    recorder.record({43, configuration, 1000, 20, {20}, {}});
+  }
+
+  auto records = autopas::TuningRecorder::read(_filename);
+  ASSERT_EQ(records.size(), 2);
+  EXPECT_EQ(records[0].iteration, 42);
+  EXPECT_EQ(records[0].configuration, configuration);
+  EXPECT_EQ(records[0].numParticles, 1000);
+  EXPECT_EQ(records[0].reducedValue, 15);
+  EXPECT_EQ(records[0].samples, (std::vector<size_t>{10, 12, 11}));
+  EXPECT_EQ(records[0].rebuildSamples, (std::vector<size_t>{50}));
+  EXPECT_TRUE(records[1].rebuildSamples.empty());
+}
+
+/**
+ * Full search has to test every recorded configuration once and select the best one.
+ */
+TEST_F(TuningRecorderTest, testReplayFullSearch) {
+  autopas::Configuration fast(autopas::ContainerOption::linkedCells, 1., autopas::TraversalOption::c08,
+                              autopas::DataLayoutOption::soa, autopas::Newton3Option::enabled);
+  autopas::Configuration slow(autopas::ContainerOption::linkedCells, 1., autopas::TraversalOption::c08,
+                              autopas::DataLayoutOption::aos, autopas::Newton3Option::enabled);
+  std::vector<autopas::TuningRecord> records{
+      {1, fast, 1000, 10, {10, 11}, {}},
+      {2, slow, 1000, 30, {30, 31}, {}},
+  };
+
+  autopasTools::tuningReplay::TuningReplay replay(records);
+  EXPECT_EQ(replay.getNumConfigurations(), 2);
+  EXPECT_EQ(replay.getBestValue(), 10);
+
+  autopas::FullSearch fullSearch(replay.getContainerOptions(), replay.getCellSizeFactors(),
+                                 replay.getTraversalOptions(), replay.getDataLayoutOptions(),
+                                 replay.getNewton3Options(), replay.getVerletSkins(),
+                                 replay.getVerletRebuildFrequencies());
+  auto result = replay.replay(fullSearch);
+  EXPECT_TRUE(result.finished);
+  EXPECT_EQ(result.optimum, fast);
+  EXPECT_EQ(result.numTested, 2);
+  EXPECT_EQ(result.tuningCost, 10 + 11 + 30 + 31);
+  EXPECT_DOUBLE_EQ(result.regret, 0.);
+}
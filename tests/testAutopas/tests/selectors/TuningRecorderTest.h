@@ -0,0 +1,20 @@
+/**
+ * @file TuningRecorderTest.h
+ * @author F. Gratl
+ * @date 16.10.26
+ */
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "AutoPasTestBase.h"
+
+class TuningRecorderTest : public AutoPasTestBase {
+ public:
+  TuningRecorderTest() = default;
+  ~TuningRecorderTest() override { std::remove(_filename.c_str()); }
+
+ protected:
+  const std::string _filename{"tuningRecorderTest.txt"};
+};
@@ -64,7 +64,8 @@ TEST_F(BayesianSearchTest, testMaxEvidence) {
   autopas::BayesianSearch bayesSearch(
       {autopas::ContainerOption::linkedCells}, autopas::NumberSetFinite<double>({1}),
       {autopas::TraversalOption::c08, autopas::TraversalOption::c01, autopas::TraversalOption::sliced},
-      {autopas::DataLayoutOption::soa}, {autopas::Newton3Option::disabled}, maxEvidence);
+      {autopas::DataLayoutOption::soa}, {autopas::Newton3Option::disabled}, autopas::NumberSetFinite<double>({0.}), {1},
+      {0}, {autopas::ScheduleOption::dynamicSchedule}, {1}, {4}, maxEvidence);
 
   // while #evidence < maxEvidence. tuning -> True
   for (size_t i = 1; i < maxEvidence; ++i) {
@@ -83,7 +84,9 @@ TEST_F(BayesianSearchTest, testFindBest) {
   autopas::BayesianSearch bayesSearch({autopas::ContainerOption::linkedCells}, autopas::NumberSetFinite<double>({1, 2}),
                                       {autopas::TraversalOption::c08, autopas::TraversalOption::c01},
                                       {autopas::DataLayoutOption::soa, autopas::DataLayoutOption::aos},
-                                      {autopas::Newton3Option::disabled, autopas::Newton3Option::enabled}, maxEvidence,
+                                      {autopas::Newton3Option::disabled, autopas::Newton3Option::enabled},
+                                      autopas::NumberSetFinite<double>({0.}), {1}, {0},
+                                      {autopas::ScheduleOption::dynamicSchedule}, {1}, {4}, maxEvidence,
                                       autopas::AcquisitionFunctionOption::lowerConfidenceBound, 50, seed);
 
   // configuration to find
@@ -103,3 +106,37 @@ TEST_F(BayesianSearchTest, testFindBest) {
   autopas::FeatureVector prediction(bayesSearch.getCurrentConfiguration());
   EXPECT_EQ(prediction, best);
 }
+
+/**
+ * With a cost model as prior the search starts at the configuration the model estimates to be the cheapest.
+ */
+TEST_F(BayesianSearchTest, testCostModelPrior) {
+  size_t maxEvidence = 3;
+  unsigned long seed = 21;
+  autopas::BayesianSearch bayesSearch({autopas::ContainerOption::linkedCells}, autopas::NumberSetFinite<double>({1}),
+                                      {autopas::TraversalOption::c08, autopas::TraversalOption::c18},
+                                      {autopas::DataLayoutOption::soa, autopas::DataLayoutOption::aos},
+                                      {autopas::Newton3Option::disabled, autopas::Newton3Option::enabled},
+                                      autopas::NumberSetFinite<double>({0.}), {1}, {0},
+                                      {autopas::ScheduleOption::dynamicSchedule}, {1}, {4}, maxEvidence,
+                                      autopas::AcquisitionFunctionOption::lowerConfidenceBound, 50, seed);
+  autopas::DomainStatistics statistics;
+  statistics.numParticles = 10000;
+  statistics.meanParticlesPerCell = 2.;
+  statistics.particlesPerCellVariance = 2.;
+  statistics.occupiedCellFraction = 0.86;
+  statistics.numThreads = 4;
+  bayesSearch.setUseCostModel(true);
+  bayesSearch.setDomainStatistics(statistics);
+  bayesSearch.reset();
+
+  autopas::Configuration cheapest(autopas::ContainerOption::linkedCells, 1., autopas::TraversalOption::c08,
+                                  autopas::DataLayoutOption::soa, autopas::Newton3Option::enabled);
+  EXPECT_EQ(bayesSearch.getCurrentConfiguration(), cheapest);
+
+  // the selected configuration is the fastest measured one, not the one with the smallest difference to the prior
+  do {
+    bayesSearch.addEvidence(bayesSearch.getCurrentConfiguration() == cheapest ? 1000000 : 2000000);
+  } while (bayesSearch.tune());
+  EXPECT_EQ(bayesSearch.getCurrentConfiguration(), cheapest);
+}
@@ -0,0 +1,107 @@
+/**
+ * @file CostModelSearchTest.cpp
+ * @author F. Gratl
+ * @date 17.10.26
+ */
+
+#include "CostModelSearchTest.h"
+
+#include <gmock/gmock-more-matchers.h>
+
+#include <map>
+#include <vector>
+
+namespace {
+autopas::DomainStatistics homogeneousDomain() {
+  autopas::DomainStatistics statistics;
+  statistics.numParticles = 10000;
+  statistics.meanParticlesPerCell = 2.;
+  statistics.particlesPerCellVariance = 2.;
+  statistics.occupiedCellFraction = 0.86;
+  statistics.cutoff = 1.;
+  return statistics;
+}
+
+autopas::Configuration lcConfig(autopas::DataLayoutOption dataLayout, autopas::Newton3Option newton3) {
+  return autopas::Configuration(autopas::ContainerOption::linkedCells, 1., autopas::TraversalOption::c08, dataLayout,
+                                newton3);
+}
+}  // namespace
+
+TEST_F(CostModelSearchTest, testSearchSpaceEmpty) {
+  autopas::CostModelSearch costModelSearch(std::set<autopas::Configuration>{});
+  EXPECT_TRUE(costModelSearch.searchSpaceIsEmpty());
+  EXPECT_FALSE(costModelSearch.searchSpaceIsTrivial());
+  EXPECT_THAT(costModelSearch.getAllowedContainerOptions(), ::testing::IsEmpty());
+}
+
+TEST_F(CostModelSearchTest, testSearchSpaceMoreOptions) {
+  autopas::CostModelSearch costModelSearch({autopas::ContainerOption::linkedCells}, {1.},
+                                           {autopas::TraversalOption::c08}, {autopas::DataLayoutOption::soa},
+                                           {autopas::Newton3Option::enabled, autopas::Newton3Option::disabled});
+  EXPECT_FALSE(costModelSearch.searchSpaceIsEmpty());
+  EXPECT_FALSE(costModelSearch.searchSpaceIsTrivial());
+  EXPECT_THAT(costModelSearch.getAllowedContainerOptions(),
+              ::testing::ElementsAre(autopas::ContainerOption::linkedCells));
+}
+
+/**
+ * Configurations are tested from the cheapest estimate on and the phase ends after maxEvidence measurements with the
+ * fastest measured configuration.
+ */
+TEST_F(CostModelSearchTest, testTuneInEstimatedOrder) {
+  const auto soaN3 = lcConfig(autopas::DataLayoutOption::soa, autopas::Newton3Option::enabled);
+  const auto aosN3 = lcConfig(autopas::DataLayoutOption::aos, autopas::Newton3Option::enabled);
+  const auto soaNoN3 = lcConfig(autopas::DataLayoutOption::soa, autopas::Newton3Option::disabled);
+  const auto aosNoN3 = lcConfig(autopas::DataLayoutOption::aos, autopas::Newton3Option::disabled);
+  // the measurements disagree with the model about SoA vs. newton 3
+  std::map<autopas::Configuration, long> times{{soaN3, 300}, {aosN3, 500}, {soaNoN3, 200}, {aosNoN3, 900}};
+
+  autopas::CostModelSearch costModelSearch({soaN3, aosN3, soaNoN3, aosNoN3}, 3);
+  costModelSearch.setDomainStatistics(homogeneousDomain());
+  costModelSearch.reset();
+
+  std::vector<autopas::Configuration> tested;
+  do {
+    tested.push_back(costModelSearch.getCurrentConfiguration());
+    costModelSearch.addEvidence(times[tested.back()]);
+  } while (costModelSearch.tune());
+
+  ASSERT_EQ(tested.size(), 3);
+  EXPECT_EQ(tested.front(), soaN3);
+  EXPECT_EQ(costModelSearch.getCostModel().getNumEvidence(), 3);
+  EXPECT_EQ(costModelSearch.getCurrentConfiguration(), soaNoN3);
+  EXPECT_THAT(tested, ::testing::Not(::testing::Contains(aosNoN3)));
+}
+
+TEST_F(CostModelSearchTest, testInvalidConfigurationIsSkipped) {
+  const auto soaN3 = lcConfig(autopas::DataLayoutOption::soa, autopas::Newton3Option::enabled);
+  const auto aosN3 = lcConfig(autopas::DataLayoutOption::aos, autopas::Newton3Option::enabled);
+
+  autopas::CostModelSearch costModelSearch({soaN3, aosN3}, 1);
+  costModelSearch.setDomainStatistics(homogeneousDomain());
+  costModelSearch.reset();
+
+  EXPECT_EQ(costModelSearch.getCurrentConfiguration(), soaN3);
+  EXPECT_TRUE(costModelSearch.tune(true));
+  EXPECT_EQ(costModelSearch.getCurrentConfiguration(), aosN3);
+  costModelSearch.addEvidence(100);
+  EXPECT_FALSE(costModelSearch.tune());
+  EXPECT_EQ(costModelSearch.getCurrentConfiguration(), aosN3);
+}
+
+TEST_F(CostModelSearchTest, testRemoveN3Option) {
+  const auto soaN3 = lcConfig(autopas::DataLayoutOption::soa, autopas::Newton3Option::enabled);
+  const auto soaNoN3 = lcConfig(autopas::DataLayoutOption::soa, autopas::Newton3Option::disabled);
+
+  autopas::CostModelSearch costModelSearch({soaN3, soaNoN3});
+  costModelSearch.setDomainStatistics(homogeneousDomain());
+  costModelSearch.reset();
+  EXPECT_EQ(costModelSearch.getCurrentConfiguration(), soaN3);
+
+  costModelSearch.removeN3Option(autopas::Newton3Option::enabled);
+  EXPECT_TRUE(costModelSearch.searchSpaceIsTrivial());
+  EXPECT_EQ(costModelSearch.getCurrentConfiguration(), soaNoN3);
+  EXPECT_THROW(costModelSearch.removeN3Option(autopas::Newton3Option::disabled),
+               autopas::utils::ExceptionHandler::AutoPasException);
+}
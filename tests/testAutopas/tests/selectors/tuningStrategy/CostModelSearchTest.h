@@ -0,0 +1,14 @@
+/**
+ * @file CostModelSearchTest.h
+ * @author F. Gratl
+ * @date 17.10.26
+ */
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "AutoPasTestBase.h"
+#include "autopas/selectors/tuningStrategy/CostModelSearch.h"
+
+class CostModelSearchTest : public AutoPasTestBase {};
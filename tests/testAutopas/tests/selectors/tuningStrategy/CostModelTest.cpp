@@ -0,0 +1,128 @@
+/**
+ * @file CostModelTest.cpp
+ * @author F. Gratl
+ * @date 17.10.26
+ */
+
+#include "CostModelTest.h"
+
+#include <vector>
+
+namespace {
+autopas::DomainStatistics homogeneousDomain(unsigned long numParticles, int numThreads = 1) {
+  autopas::DomainStatistics statistics;
+  statistics.numParticles = numParticles;
+  statistics.meanParticlesPerCell = 2.;
+  // uniformly distributed particles have a variance equal to the mean
+  statistics.particlesPerCellVariance = 2.;
+  statistics.occupiedCellFraction = 0.86;
+  statistics.numThreads = numThreads;
+  statistics.cutoff = 1.;
+  return statistics;
+}
+
+autopas::Configuration lcConfig(autopas::TraversalOption traversal, autopas::DataLayoutOption dataLayout,
+                                autopas::Newton3Option newton3) {
+  return autopas::Configuration(autopas::ContainerOption::linkedCells, 1., traversal, dataLayout, newton3);
+}
+}  // namespace
+
+TEST_F(CostModelTest, testInvalidRegularization) {
+  EXPECT_THROW(autopas::CostModel(0.), autopas::utils::ExceptionHandler::AutoPasException);
+}
+
+/**
+ * Without measurements the estimates have to reflect the basic trade-offs between the options.
+ */
+TEST_F(CostModelTest, testDefaultRanking) {
+  autopas::CostModel costModel;
+  costModel.setStatistics(homogeneousDomain(100000));
+
+  const auto aosN3 = lcConfig(autopas::TraversalOption::c08, autopas::DataLayoutOption::aos,
+                              autopas::Newton3Option::enabled);
+  const auto aosNoN3 = lcConfig(autopas::TraversalOption::c08, autopas::DataLayoutOption::aos,
+                                autopas::Newton3Option::disabled);
+  const auto soaN3 = lcConfig(autopas::TraversalOption::c08, autopas::DataLayoutOption::soa,
+                              autopas::Newton3Option::enabled);
+  const autopas::Configuration directSum(autopas::ContainerOption::directSum, 1.,
+                                         autopas::TraversalOption::directSumTraversal, autopas::DataLayoutOption::aos,
+                                         autopas::Newton3Option::enabled);
+  const autopas::Configuration verletLists(autopas::ContainerOption::verletLists, 1.,
+                                           autopas::TraversalOption::verletTraversal, autopas::DataLayoutOption::aos,
+                                           autopas::Newton3Option::enabled, 0.2, 10);
+
+  EXPECT_LT(costModel.estimate(aosN3), costModel.estimate(aosNoN3));
+  EXPECT_LT(costModel.estimate(soaN3), costModel.estimate(aosN3));
+  EXPECT_LT(costModel.estimate(aosN3), costModel.estimate(directSum));
+  // the sphere around a particle holds fewer neighbors than the 27 cells around its cell
+  EXPECT_LT(costModel.estimate(verletLists), costModel.estimate(aosN3));
+}
+
+/**
+ * Traversals with many colors can not keep many threads busy in small domains.
+ */
+TEST_F(CostModelTest, testColorsLimitThreads) {
+  autopas::CostModel costModel;
+  costModel.setStatistics(homogeneousDomain(54, 16));
+
+  const auto c18 = lcConfig(autopas::TraversalOption::c18, autopas::DataLayoutOption::aos,
+                            autopas::Newton3Option::disabled);
+  const auto c01 = lcConfig(autopas::TraversalOption::c01, autopas::DataLayoutOption::aos,
+                            autopas::Newton3Option::disabled);
+  const auto c18Features = costModel.getFeatures(c18);
+  const auto c01Features = costModel.getFeatures(c01);
+
+  EXPECT_EQ(c18Features[autopas::CostModel::colors], 18.);
+  EXPECT_EQ(c01Features[autopas::CostModel::colors], 1.);
+  // 27 cells give 1.5 cells per color for c18 but 16 threads can work on c01
+  EXPECT_NEAR(c18Features[autopas::CostModel::aosPairChecks] / c01Features[autopas::CostModel::aosPairChecks],
+              16. / 1.5, 1e-10);
+}
+
+/**
+ * Measurements that follow the model with different weights have to be reproduced after calibration.
+ */
+TEST_F(CostModelTest, testCalibration) {
+  autopas::CostModel costModel(1e-6);
+  const autopas::CostModel::FeatureArray trueWeights{3., 1., 40., 25., 6., 500., 5000.};
+
+  std::vector<autopas::Configuration> configurations;
+  for (auto traversal : {autopas::TraversalOption::c08, autopas::TraversalOption::c18, autopas::TraversalOption::c01}) {
+    for (auto dataLayout : {autopas::DataLayoutOption::aos, autopas::DataLayoutOption::soa}) {
+      for (auto newton3 : {autopas::Newton3Option::enabled, autopas::Newton3Option::disabled}) {
+        configurations.push_back(lcConfig(traversal, dataLayout, newton3));
+      }
+    }
+  }
+  for (auto rebuildFrequency : {1u, 5u, 20u}) {
+    configurations.emplace_back(autopas::ContainerOption::verletLists, 1., autopas::TraversalOption::verletTraversal,
+                                autopas::DataLayoutOption::aos, autopas::Newton3Option::enabled, 0.3,
+                                rebuildFrequency);
+  }
+
+  auto trueTime = [&](const autopas::Configuration &configuration) {
+    const auto features = costModel.getFeatures(configuration);
+    double time = 0.;
+    for (size_t i = 0; i < autopas::CostModel::numFeatures; ++i) {
+      time += trueWeights[i] * features[i];
+    }
+    return time;
+  };
+
+  // measurements in domains of different sizes and with different thread counts
+  for (auto [numParticles, numThreads] : {std::pair{1000ul, 1}, std::pair{20000ul, 4}, std::pair{50ul, 8}}) {
+    costModel.setStatistics(homogeneousDomain(numParticles, numThreads));
+    for (const auto &configuration : configurations) {
+      costModel.addEvidence(configuration, static_cast<long>(trueTime(configuration)));
+    }
+  }
+  EXPECT_EQ(costModel.getNumEvidence(), 3 * configurations.size());
+
+  costModel.setStatistics(homogeneousDomain(5000, 2));
+  for (const auto &configuration : configurations) {
+    EXPECT_NEAR(costModel.estimate(configuration) / trueTime(configuration), 1., 0.02) << configuration.toString();
+  }
+
+  costModel.clearEvidence();
+  EXPECT_EQ(costModel.getWeights(), autopas::CostModel::getDefaultWeights());
+}
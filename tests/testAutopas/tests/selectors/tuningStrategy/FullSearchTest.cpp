@@ -82,3 +82,55 @@ TEST_F(FullSearchTest, testTune) {
                                    autopas::DataLayoutOption::soa, autopas::Newton3Option::disabled),
             fullSearch.getCurrentConfiguration());
 }
+
+TEST_F(FullSearchTest, testSearchSpaceVerletParameters) {
+  autopas::FullSearch fullSearch({autopas::ContainerOption::verletLists}, {1.},
+                                 {autopas::TraversalOption::verletTraversal}, {autopas::DataLayoutOption::aos},
+                                 {autopas::Newton3Option::enabled}, {0.1, 0.3}, {5, 10, 20});
+
+  std::set<std::pair<double, unsigned int>> seenCombinations;
+  do {
+    const auto &config = fullSearch.getCurrentConfiguration();
+    seenCombinations.emplace(config.verletSkin, config.verletRebuildFrequency);
+    fullSearch.addEvidence(1);
+  } while (fullSearch.tune());
+
+  EXPECT_EQ(seenCombinations.size(), 6);
+  EXPECT_EQ(seenCombinations.count({0.3, 20}), 1);
+}
+
+TEST_F(FullSearchTest, testSearchSpaceOpenMPParameters) {
+  autopas::FullSearch fullSearch(
+      {autopas::ContainerOption::linkedCells}, {1.}, {autopas::TraversalOption::c08}, {autopas::DataLayoutOption::aos},
+      {autopas::Newton3Option::enabled}, {0.}, {1}, {1, 2},
+      {autopas::ScheduleOption::staticSchedule, autopas::ScheduleOption::guidedSchedule}, {1, 4});
+
+  std::set<std::tuple<unsigned int, autopas::ScheduleOption, unsigned int>> seenCombinations;
+  do {
+    const auto &config = fullSearch.getCurrentConfiguration();
+    seenCombinations.emplace(config.numThreads, config.schedule, config.scheduleChunkSize);
+    fullSearch.addEvidence(1);
+  } while (fullSearch.tune());
+
+  EXPECT_EQ(seenCombinations.size(), 8);
+  EXPECT_EQ(seenCombinations.count({2, autopas::ScheduleOption::guidedSchedule, 4}), 1);
+}
+
+TEST_F(FullSearchTest, testSearchSpaceClusterSizes) {
+  autopas::FullSearch fullSearch(
+      {autopas::ContainerOption::linkedCells, autopas::ContainerOption::verletClusterLists}, {1.},
+      {autopas::TraversalOption::c08, autopas::TraversalOption::verletClusters}, {autopas::DataLayoutOption::aos},
+      {autopas::Newton3Option::disabled}, {0.}, {1}, {0}, {autopas::ScheduleOption::dynamicSchedule}, {1}, {4, 8, 16});
+
+  std::set<std::pair<autopas::ContainerOption, unsigned int>> seenCombinations;
+  do {
+    const auto &config = fullSearch.getCurrentConfiguration();
+    seenCombinations.emplace(config.container, config.verletClusterSize);
+    fullSearch.addEvidence(1);
+  } while (fullSearch.tune());
+
+  // the cluster size is only varied for the cluster containers
+  EXPECT_EQ(seenCombinations.size(), 4);
+  EXPECT_EQ(seenCombinations.count({autopas::ContainerOption::linkedCells, 4}), 1);
+  EXPECT_EQ(seenCombinations.count({autopas::ContainerOption::verletClusterLists, 16}), 1);
+}
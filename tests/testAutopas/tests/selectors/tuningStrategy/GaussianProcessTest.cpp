@@ -126,6 +126,35 @@ TEST_F(GaussianProcessTest, clear) {
   EXPECT_NEAR(gp.predictVar(f2), 0., epsilon);
 }
 
+/**
+ * Every new evidence extends the covariance of the previous best hyperparameters incrementally. Predictions at the
+ * evidence have to stay exact over many updates.
+ */
+TEST_F(GaussianProcessTest, manyEvidence) {
+  Random rng(42);
+
+  double epsilon = 0.05;  // allowed error for tests
+  double sigma = 0.001;   // noise
+  GaussianProcess<Eigen::VectorXd> gp(1, sigma, rng);
+
+  constexpr size_t numEvidence = 15;
+  std::vector<Eigen::VectorXd> inputs;
+  std::vector<double> outputs;
+  for (size_t i = 0; i < numEvidence; ++i) {
+    Eigen::VectorXd input(1);
+    // inputs far apart so every evidence only determines the prediction around itself
+    input << 100. * i;
+    inputs.push_back(input);
+    outputs.push_back(std::cos(static_cast<double>(i)) * 10.);
+    gp.addEvidence(inputs.back(), outputs.back());
+  }
+
+  for (size_t i = 0; i < numEvidence; ++i) {
+    EXPECT_NEAR(gp.predictMean(inputs[i]), outputs[i], epsilon);
+    EXPECT_NEAR(gp.predictVar(inputs[i]), 0., epsilon);
+  }
+}
+
 TEST_F(GaussianProcessTest, sine) {
   Random rng(42);
 
@@ -0,0 +1,110 @@
+/**
+ * @file SuccessiveHalvingTest.cpp
+ * @author F. Gratl
+ * @date 16.10.26
+ */
+
+#include "SuccessiveHalvingTest.h"
+
+#include <gmock/gmock-more-matchers.h>
+
+#include <map>
+
+namespace {
+autopas::Configuration lcConfig(autopas::TraversalOption traversal,
+                                autopas::Newton3Option newton3 = autopas::Newton3Option::disabled) {
+  return autopas::Configuration(autopas::ContainerOption::linkedCells, 1., traversal, autopas::DataLayoutOption::aos,
+                                newton3);
+}
+}  // namespace
+
+TEST_F(SuccessiveHalvingTest, testSearchSpaceEmpty) {
+  autopas::SuccessiveHalving successiveHalving(std::set<autopas::Configuration>{});
+  EXPECT_TRUE(successiveHalving.searchSpaceIsEmpty());
+  EXPECT_FALSE(successiveHalving.searchSpaceIsTrivial());
+  EXPECT_THAT(successiveHalving.getAllowedContainerOptions(), ::testing::IsEmpty());
+}
+
+TEST_F(SuccessiveHalvingTest, testSearchSpaceMoreOptions) {
+  autopas::SuccessiveHalving successiveHalving({autopas::ContainerOption::linkedCells}, {1.},
+                                               {autopas::TraversalOption::c08}, {autopas::DataLayoutOption::soa},
+                                               {autopas::Newton3Option::enabled, autopas::Newton3Option::disabled});
+  EXPECT_FALSE(successiveHalving.searchSpaceIsEmpty());
+  EXPECT_FALSE(successiveHalving.searchSpaceIsTrivial());
+  EXPECT_THAT(successiveHalving.getAllowedContainerOptions(),
+              ::testing::ElementsAre(autopas::ContainerOption::linkedCells));
+}
+
+TEST_F(SuccessiveHalvingTest, testInvalidReductionFactor) {
+  EXPECT_THROW(autopas::SuccessiveHalving({lcConfig(autopas::TraversalOption::c08)}, 1.),
+               autopas::utils::ExceptionHandler::AutoPasException);
+}
+
+/**
+ * Four configurations with a reduction factor of two need three rounds with 4 + 2 = 6 measurements.
+ * The ranking uses the mean of all measurements of a configuration.
+ */
+TEST_F(SuccessiveHalvingTest, testTune) {
+  std::map<autopas::Configuration, std::vector<long>> times{
+      {lcConfig(autopas::TraversalOption::c08), {10, 40}},
+      {lcConfig(autopas::TraversalOption::c01), {50}},
+      {lcConfig(autopas::TraversalOption::c18), {20, 20}},
+      {lcConfig(autopas::TraversalOption::sliced), {60}},
+  };
+  std::set<autopas::Configuration> configs;
+  for (const auto &[config, _] : times) {
+    configs.insert(config);
+  }
+  autopas::SuccessiveHalving successiveHalving(configs);
+
+  std::map<autopas::Configuration, size_t> timesTested;
+  size_t numEvidence = 0;
+  do {
+    const auto &config = successiveHalving.getCurrentConfiguration();
+    successiveHalving.addEvidence(times[config].at(timesTested[config]++));
+    ++numEvidence;
+  } while (successiveHalving.tune());
+
+  EXPECT_EQ(numEvidence, 6);
+  EXPECT_EQ(timesTested[lcConfig(autopas::TraversalOption::c01)], 1);
+  EXPECT_EQ(timesTested[lcConfig(autopas::TraversalOption::sliced)], 1);
+  EXPECT_EQ(successiveHalving.getCurrentConfiguration(), lcConfig(autopas::TraversalOption::c18));
+
+  // a new tuning phase starts from scratch
+  successiveHalving.reset();
+  EXPECT_EQ(successiveHalving.getCurrentConfiguration(), *configs.begin());
+}
+
+TEST_F(SuccessiveHalvingTest, testInvalidConfigurationIsDropped) {
+  std::set<autopas::Configuration> configs{lcConfig(autopas::TraversalOption::c08),
+                                           lcConfig(autopas::TraversalOption::c01)};
+  autopas::SuccessiveHalving successiveHalving(configs);
+
+  const auto invalidConfig = successiveHalving.getCurrentConfiguration();
+  EXPECT_TRUE(successiveHalving.tune(true));
+  const auto validConfig = successiveHalving.getCurrentConfiguration();
+  EXPECT_NE(validConfig, invalidConfig);
+  successiveHalving.addEvidence(1);
+  EXPECT_FALSE(successiveHalving.tune()) << "Only one valid configuration left after the first round.";
+  EXPECT_EQ(successiveHalving.getCurrentConfiguration(), validConfig);
+}
+
+TEST_F(SuccessiveHalvingTest, testRemoveN3Option) {
+  std::set<autopas::Configuration> configs{lcConfig(autopas::TraversalOption::c08, autopas::Newton3Option::enabled),
+                                           lcConfig(autopas::TraversalOption::c08, autopas::Newton3Option::disabled),
+                                           lcConfig(autopas::TraversalOption::c18, autopas::Newton3Option::enabled),
+                                           lcConfig(autopas::TraversalOption::c18, autopas::Newton3Option::disabled)};
+  autopas::SuccessiveHalving successiveHalving(configs);
+
+  EXPECT_NO_THROW(successiveHalving.removeN3Option(autopas::Newton3Option::enabled));
+  size_t numEvidence = 0;
+  do {
+    EXPECT_EQ(successiveHalving.getCurrentConfiguration().newton3, autopas::Newton3Option::disabled);
+    successiveHalving.addEvidence(1);
+    ++numEvidence;
+  } while (successiveHalving.tune());
+  EXPECT_EQ(numEvidence, 2);
+
+  EXPECT_THROW(successiveHalving.removeN3Option(autopas::Newton3Option::disabled),
+               autopas::utils::ExceptionHandler::AutoPasException);
+}
@@ -0,0 +1,14 @@
+/**
+ * @file SuccessiveHalvingTest.h
+ * @author F. Gratl
+ * @date 16.10.26
+ */
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "AutoPasTestBase.h"
+#include "autopas/selectors/tuningStrategy/SuccessiveHalving.h"
+
+class SuccessiveHalvingTest : public AutoPasTestBase {};
@@ -148,3 +148,14 @@ TEST(NumberSetTest, testStringRepresentation) {
   NumberSetFinite<double> fSet({1., 2., 3.});
   EXPECT_EQ("[1, 2, 3]", fSet.to_string());
 }
+
+TEST(NumberSetTest, testContains) {
+  NumberSetFinite<double> fSet({1., 2., 3.});
+  EXPECT_TRUE(fSet.contains(2.));
+  EXPECT_FALSE(fSet.contains(2.5));
+
+  NumberInterval<double> iSet(1., 3.);
+  EXPECT_TRUE(iSet.contains(1.));
+  EXPECT_TRUE(iSet.contains(2.5));
+  EXPECT_FALSE(iSet.contains(3.5));
+}
@@ -0,0 +1,54 @@
+/**
+ * @file PerformanceCountersTest.cpp
+ * @author F. Gratl
+ * @date 17.10.26
+ */
+
+#include "PerformanceCountersTest.h"
+
+TEST_F(PerformanceCountersTest, testDerivedMetrics) {
+  autopas::utils::PerformanceCounterValues values;
+  EXPECT_EQ(values.getIPC(), 0.);
+  EXPECT_EQ(values.getLLCMissRate(), 0.);
+
+  values.cycles = 100.;
+  values.instructions = 250.;
+  values.llcReferences = 10.;
+  values.llcMisses = 2.;
+  values.numMeasurements = 1;
+  autopas::utils::PerformanceCounterValues other = values;
+  other.flops = 50.;
+  other.hasFlops = true;
+  values += other;
+
+  EXPECT_EQ(values.numMeasurements, 2);
+  EXPECT_TRUE(values.hasFlops);
+  EXPECT_DOUBLE_EQ(values.getIPC(), 2.5);
+  EXPECT_DOUBLE_EQ(values.getLLCMissRate(), 0.2);
+  EXPECT_DOUBLE_EQ(values.getLLCMissesPerKiloInstruction(), 8.);
+  EXPECT_DOUBLE_EQ(values.getFlopsPerCycle(), 0.25);
+}
+
+/**
+ * Counts have to be plausible if the counters are available and zero otherwise.
+ */
+TEST_F(PerformanceCountersTest, testMeasure) {
+  autopas::utils::PerformanceCounters counters;
+
+  counters.start();
+  volatile double sum = 0.;
+  for (int i = 0; i < 100000; ++i) {
+    sum = sum + i * 0.5;
+  }
+  const auto values = counters.stop();
+
+  if (counters.isAvailable()) {
+    EXPECT_EQ(values.numMeasurements, 1);
+    EXPECT_GT(values.cycles, 0.);
+    EXPECT_GT(values.instructions, 100000.);
+  } else {
+    EXPECT_EQ(values.numMeasurements, 0);
+    EXPECT_EQ(values.cycles, 0.);
+    EXPECT_EQ(values.instructions, 0.);
+  }
+}
@@ -0,0 +1,14 @@
+/**
+ * @file PerformanceCountersTest.h
+ * @author F. Gratl
+ * @date 17.10.26
+ */
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "AutoPasTestBase.h"
+#include "autopas/utils/PerformanceCounters.h"
+
+class PerformanceCountersTest : public AutoPasTestBase {};
@@ -0,0 +1,100 @@
+/**
+ * @file TraceRecorderTest.cpp
+ * @author F. Gratl
+ * @date 17.10.26
+ */
+
+#include "TraceRecorderTest.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include "autopas/containers/linkedCells/traversals/C08Traversal.h"
+#include "autopas/containers/linkedCells/traversals/SlicedTraversal.h"
+#include "autopasTools/generators/GridGenerator.h"
+#include "testingHelpers/NumThreadGuard.h"
+#include "testingHelpers/commonTypedefs.h"
+
+using ::testing::_;
+
+namespace {
+size_t countEvents(const std::vector<autopas::utils::TraceRecorder::Event> &events, const char *name) {
+  return std::count_if(events.begin(), events.end(),
+                       [&](const auto &event) { return std::strcmp(event.name, name) == 0; });
+}
+}  // namespace
+
+TEST_F(TraceRecorderTest, testDisabled) {
+  { autopas::utils::TraceScope scope("color", 0); }
+  EXPECT_TRUE(autopas::utils::TraceRecorder::getEvents().empty());
+}
+
+TEST_F(TraceRecorderTest, testChromeTrace) {
+  autopas::utils::TraceRecorder::setEnabled(true);
+  { autopas::utils::TraceScope scope("color", 3); }
+  { autopas::utils::TraceScope scope("barrier"); }
+
+  const auto events = autopas::utils::TraceRecorder::getEvents();
+  ASSERT_EQ(events.size(), 2);
+  EXPECT_EQ(events[0].index, 3);
+  EXPECT_LE(events[0].begin, events[0].end);
+  EXPECT_LE(events[0].end, events[1].begin);
+
+  autopas::utils::TraceRecorder::writeChromeTrace(_filename);
+  std::ifstream in(_filename);
+  std::stringstream content;
+  content << in.rdbuf();
+  const auto trace = content.str();
+  EXPECT_EQ(trace.rfind("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", 0), 0);
+  EXPECT_NE(trace.find("\"name\":\"color\",\"cat\":\"traversal\",\"ph\":\"X\""), std::string::npos);
+  EXPECT_NE(trace.find("\"args\":{\"index\":3}"), std::string::npos);
+  EXPECT_NE(trace.find("\"name\":\"thread_name\""), std::string::npos);
+}
+
+/**
+ * Every thread records every color of the c08 traversal and with OpenMP also the barrier after it.
+ */
+TEST_F(TraceRecorderTest, testC08Traversal) {
+  const std::array<size_t, 3> edgeLength{5, 5, 5};
+  std::vector<FPCell> cells(edgeLength[0] * edgeLength[1] * edgeLength[2]);
+  autopasTools::generators::GridGenerator::fillWithParticles(cells, edgeLength, edgeLength);
+  NumThreadGuard numThreadGuard(2);
+
+  MFunctor functor;
+  EXPECT_CALL(functor, AoSFunctor(_, _, true)).Times(::testing::AtLeast(1));
+  autopas::C08Traversal<FPCell, MFunctor, autopas::DataLayoutOption::aos, true> traversal(edgeLength, &functor, 1.,
+                                                                                          {1., 1., 1.});
+  traversal.setCellsToTraverse(cells);
+
+  autopas::utils::TraceRecorder::setEnabled(true);
+  traversal.traverseParticlePairs();
+
+  const auto events = autopas::utils::TraceRecorder::getEvents();
+  const size_t numThreads = autopas::autopas_get_max_threads();
+  EXPECT_EQ(countEvents(events, "color"), 8 * numThreads);
+#if defined(AUTOPAS_OPENMP)
+  EXPECT_EQ(countEvents(events, "barrier"), 8 * numThreads);
+#endif
+}
+
+TEST_F(TraceRecorderTest, testSlicedTraversal) {
+  const std::array<size_t, 3> edgeLength{8, 8, 8};
+  std::vector<FPCell> cells(edgeLength[0] * edgeLength[1] * edgeLength[2]);
+  autopasTools::generators::GridGenerator::fillWithParticles(cells, edgeLength, edgeLength);
+  NumThreadGuard numThreadGuard(2);
+
+  MFunctor functor;
+  EXPECT_CALL(functor, AoSFunctor(_, _, true)).Times(::testing::AtLeast(1));
+  autopas::SlicedTraversal<FPCell, MFunctor, autopas::DataLayoutOption::aos, true> traversal(edgeLength, &functor, 1.,
+                                                                                             {1., 1., 1.});
+  traversal.setCellsToTraverse(cells);
+
+  autopas::utils::TraceRecorder::setEnabled(true);
+  traversal.traverseParticlePairs();
+
+  const auto events = autopas::utils::TraceRecorder::getEvents();
+  // one slice per thread
+  EXPECT_EQ(countEvents(events, "slice"), autopas::autopas_get_max_threads());
+}
@@ -0,0 +1,26 @@
+/**
+ * @file TraceRecorderTest.h
+ * @author F. Gratl
+ * @date 17.10.26
+ */
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "AutoPasTestBase.h"
+#include "autopas/utils/TraceRecorder.h"
+
+class TraceRecorderTest : public AutoPasTestBase {
+ public:
+  TraceRecorderTest() = default;
+
+  ~TraceRecorderTest() override {
+    autopas::utils::TraceRecorder::setEnabled(false);
+    autopas::utils::TraceRecorder::clear();
+    std::remove(_filename.c_str());
+  }
+
+ protected:
+  const std::string _filename{"traceRecorderTest.json"};
+};
@@ -0,0 +1,240 @@
+/**
+ * @file TuningReplay.h
+ * @author F. Gratl
+ * @date 16.10.26
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <set>
+#include <vector>
+
+#include "autopas/selectors/Configuration.h"
+#include "autopas/selectors/TuningRecorder.h"
+#include "autopas/selectors/tuningStrategy/TuningStrategyInterface.h"
+
+namespace autopasTools::tuningReplay {
+
+/**
+ * Outcome of replaying recorded measurements against a tuning strategy.
+ */
+struct ReplayResult {
+  /**
+   * Configuration the strategy selected at the end of the tuning phase.
+   */
+  autopas::Configuration optimum{};
+  /**
+   * Sum of all traversal and rebuild times of the configurations the strategy tested in nanoseconds.
+   */
+  size_t tuningCost{0};
+  /**
+   * Number of configurations the strategy tested. Configurations tested multiple times count multiple times.
+   */
+  size_t numTested{0};
+  /**
+   * Difference between the evidence of the selected configuration and the best recorded one in nanoseconds.
+   * NaN if the selected configuration was never recorded.
+   */
+  double regret{std::numeric_limits<double>::quiet_NaN()};
+  /**
+   * False if the strategy was stopped because it exceeded the step limit.
+   */
+  bool finished{false};
+};
+
+/**
+ * Replays measurements recorded by autopas::TuningRecorder against tuning strategies.
+ *
+ * All records of a configuration are merged: its evidence is the median of the recorded evidence and its cost is the
+ * mean time all samples of one record took. Configurations the strategy suggests but that were never recorded are
+ * treated like configurations that are not applicable.
+ */
+class TuningReplay {
+ public:
+  /**
+   * Constructor.
+   * @param records
+   */
+  explicit TuningReplay(const std::vector<autopas::TuningRecord> &records) {
+    std::map<autopas::Configuration, std::vector<size_t>> values, costs;
+    for (const auto &record : records) {
+      values[record.configuration].push_back(record.reducedValue);
+      size_t cost = 0;
+      for (auto sample : record.samples) cost += sample;
+      for (auto sample : record.rebuildSamples) cost += sample;
+      costs[record.configuration].push_back(cost);
+    }
+
+    for (auto &[configuration, configValues] : values) {
+      std::sort(configValues.begin(), configValues.end());
+      const auto &configCosts = costs[configuration];
+      size_t costSum = 0;
+      for (auto cost : configCosts) costSum += cost;
+      _measurements[configuration] = {configValues[(configValues.size() - 1) / 2], costSum / configCosts.size()};
+
+      _containerOptions.insert(configuration.container);
+      _cellSizeFactors.insert(configuration.cellSizeFactor);
+      _traversalOptions.insert(configuration.traversal);
+      _dataLayoutOptions.insert(configuration.dataLayout);
+      _newton3Options.insert(configuration.newton3);
+      _verletSkins.insert(configuration.verletSkin);
+      _verletRebuildFrequencies.insert(configuration.verletRebuildFrequency);
+      _numThreads.insert(configuration.numThreads);
+      _scheduleOptions.insert(configuration.schedule);
+      _scheduleChunkSizes.insert(configuration.scheduleChunkSize);
+      _verletClusterSizes.insert(configuration.verletClusterSize);
+    }
+  }
+
+  /**
+   * Run one tuning phase of the given strategy on the recorded measurements.
+   * @param strategy Strategy whose search space should be spanned by the getters of this class.
+   * @param maxSteps Upper bound for the number of configurations the strategy may suggest.
+   * @return
+   */
+  ReplayResult replay(autopas::TuningStrategyInterface &strategy, size_t maxSteps = 10000) const {
+    ReplayResult result;
+    strategy.reset();
+    for (size_t step = 0; step < maxSteps; ++step) {
+      auto measurement = _measurements.find(strategy.getCurrentConfiguration());
+      bool stillTuning;
+      if (measurement == _measurements.end()) {
+        stillTuning = strategy.tune(true);
+      } else {
+        result.tuningCost += measurement->second.cost;
+        ++result.numTested;
+        strategy.addEvidence(measurement->second.value);
+        stillTuning = strategy.tune();
+      }
+      if (not stillTuning) {
+        result.finished = true;
+        break;
+      }
+    }
+
+    result.optimum = strategy.getCurrentConfiguration();
+    auto measurement = _measurements.find(result.optimum);
+    if (measurement != _measurements.end()) {
+      result.regret = static_cast<double>(measurement->second.value) - getBestValue();
+    }
+    return result;
+  }
+
+  /**
+   * Get the evidence of the fastest recorded configuration.
+   * @return
+   */
+  double getBestValue() const {
+    double best = std::numeric_limits<double>::infinity();
+    for (const auto &[configuration, measurement] : _measurements) {
+      best = std::min(best, static_cast<double>(measurement.value));
+    }
+    return best;
+  }
+
+  /**
+   * Get the number of distinct recorded configurations.
+   * @return
+   */
+  size_t getNumConfigurations() const { return _measurements.size(); }
+
+  /**
+   * Get all recorded container options.
+   * @return
+   */
+  const std::set<autopas::ContainerOption> &getContainerOptions() const { return _containerOptions; }
+
+  /**
+   * Get all recorded cell size factors.
+   * @return
+   */
+  const std::set<double> &getCellSizeFactors() const { return _cellSizeFactors; }
+
+  /**
+   * Get all recorded traversal options.
+   * @return
+   */
+  const std::set<autopas::TraversalOption> &getTraversalOptions() const { return _traversalOptions; }
+
+  /**
+   * Get all recorded data layouts.
+   * @return
+   */
+  const std::set<autopas::DataLayoutOption> &getDataLayoutOptions() const { return _dataLayoutOptions; }
+
+  /**
+   * Get all recorded newton 3 options.
+   * @return
+   */
+  const std::set<autopas::Newton3Option> &getNewton3Options() const { return _newton3Options; }
+
+  /**
+   * Get all recorded verlet skins.
+   * @return
+   */
+  const std::set<double> &getVerletSkins() const { return _verletSkins; }
+
+  /**
+   * Get all recorded verlet rebuild frequencies.
+   * @return
+   */
+  const std::set<unsigned int> &getVerletRebuildFrequencies() const { return _verletRebuildFrequencies; }
+
+  /**
+   * Get all recorded thread counts.
+   * @return
+   */
+  const std::set<unsigned int> &getNumThreads() const { return _numThreads; }
+
+  /**
+   * Get all recorded schedule options.
+   * @return
+   */
+  const std::set<autopas::ScheduleOption> &getScheduleOptions() const { return _scheduleOptions; }
+
+  /**
+   * Get all recorded schedule chunk sizes.
+   * @return
+   */
+  const std::set<unsigned int> &getScheduleChunkSizes() const { return _scheduleChunkSizes; }
+
+  /**
+   * Get all recorded verlet cluster sizes.
+   * @return
+   */
+  const std::set<unsigned int> &getVerletClusterSizes() const { return _verletClusterSizes; }
+
+ private:
+  /**
+   * Merged records of one configuration.
+   */
+  struct Measurement {
+    /**
+     * Evidence passed to the strategy.
+     */
+    size_t value;
+    /**
+     * Time it takes to measure the configuration once.
+     */
+    size_t cost;
+  };
+
+  std::map<autopas::Configuration, Measurement> _measurements;
+
+  std::set<autopas::ContainerOption> _containerOptions;
+  std::set<double> _cellSizeFactors;
+  std::set<autopas::TraversalOption> _traversalOptions;
+  std::set<autopas::DataLayoutOption> _dataLayoutOptions;
+  std::set<autopas::Newton3Option> _newton3Options;
+  std::set<double> _verletSkins;
+  std::set<unsigned int> _verletRebuildFrequencies;
+  std::set<unsigned int> _numThreads;
+  std::set<autopas::ScheduleOption> _scheduleOptions;
+  std::set<unsigned int> _scheduleChunkSizes;
+  std::set<unsigned int> _verletClusterSizes;
+};
+
+}  // namespace autopasTools::tuningReplay
@@ -0,0 +1,125 @@
+/**
+ * @file tuning-replay.cpp
+ * @author F. Gratl
+ * @date 16.10.26
+ *
+ * Replays measurements recorded via AutoPas::setTuningRecordFile() against tuning strategies and reports how much
+ * tuning time each strategy spends and how far its choice is from the best recorded configuration.
+ */
+
+#include <iomanip>
+#include <iostream>
+#include <memory>
+
+#include "autopas/options/TuningStrategyOption.h"
+#include "autopas/selectors/TuningRecorder.h"
+#include "autopas/selectors/tuningStrategy/ActiveHarmony.h"
+#include "autopas/selectors/tuningStrategy/BayesianSearch.h"
+#include "autopas/selectors/tuningStrategy/CostModelSearch.h"
+#include "autopas/selectors/tuningStrategy/FullSearch.h"
+#include "autopas/selectors/tuningStrategy/RandomSearch.h"
+#include "autopas/selectors/tuningStrategy/SuccessiveHalving.h"
+#include "autopas/utils/NumberSetFinite.h"
+#include "autopasTools/tuningReplay/TuningReplay.h"
+
+using autopasTools::tuningReplay::TuningReplay;
+
+/**
+ * Creates a tuning strategy whose search space is spanned by all recorded options.
+ * @param option
+ * @param replay
+ * @param maxEvidence
+ * @return
+ */
+std::unique_ptr<autopas::TuningStrategyInterface> generateTuningStrategy(autopas::TuningStrategyOption option,
+                                                                         const TuningReplay &replay,
+                                                                         size_t maxEvidence) {
+  const autopas::NumberSetFinite<double> cellSizeFactors(replay.getCellSizeFactors());
+  const autopas::NumberSetFinite<double> verletSkins(replay.getVerletSkins());
+  switch (static_cast<autopas::TuningStrategyOption>(option)) {
+    case autopas::TuningStrategyOption::randomSearch: {
+      return std::make_unique<autopas::RandomSearch>(
+          replay.getContainerOptions(), cellSizeFactors, replay.getTraversalOptions(), replay.getDataLayoutOptions(),
+          replay.getNewton3Options(), verletSkins, replay.getVerletRebuildFrequencies(), replay.getNumThreads(),
+          replay.getScheduleOptions(), replay.getScheduleChunkSizes(), replay.getVerletClusterSizes(), maxEvidence);
+    }
+    case autopas::TuningStrategyOption::fullSearch: {
+      return std::make_unique<autopas::FullSearch>(
+          replay.getContainerOptions(), replay.getCellSizeFactors(), replay.getTraversalOptions(),
+          replay.getDataLayoutOptions(), replay.getNewton3Options(), replay.getVerletSkins(),
+          replay.getVerletRebuildFrequencies(), replay.getNumThreads(), replay.getScheduleOptions(),
+          replay.getScheduleChunkSizes(), replay.getVerletClusterSizes());
+    }
+    case autopas::TuningStrategyOption::bayesianSearch: {
+      return std::make_unique<autopas::BayesianSearch>(
+          replay.getContainerOptions(), cellSizeFactors, replay.getTraversalOptions(), replay.getDataLayoutOptions(),
+          replay.getNewton3Options(), verletSkins, replay.getVerletRebuildFrequencies(), replay.getNumThreads(),
+          replay.getScheduleOptions(), replay.getScheduleChunkSizes(), replay.getVerletClusterSizes(), maxEvidence);
+    }
+    case autopas::TuningStrategyOption::activeHarmony: {
+      return std::make_unique<autopas::ActiveHarmony>(
+          replay.getContainerOptions(), cellSizeFactors, replay.getTraversalOptions(), replay.getDataLayoutOptions(),
+          replay.getNewton3Options(), verletSkins, replay.getVerletRebuildFrequencies(), replay.getNumThreads(),
+          replay.getScheduleOptions(), replay.getScheduleChunkSizes(), replay.getVerletClusterSizes());
+    }
+    case autopas::TuningStrategyOption::successiveHalving: {
+      return std::make_unique<autopas::SuccessiveHalving>(
+          replay.getContainerOptions(), replay.getCellSizeFactors(), replay.getTraversalOptions(),
+          replay.getDataLayoutOptions(), replay.getNewton3Options(), replay.getVerletSkins(),
+          replay.getVerletRebuildFrequencies(), replay.getNumThreads(), replay.getScheduleOptions(),
+          replay.getScheduleChunkSizes(), replay.getVerletClusterSizes());
+    }
+    case autopas::TuningStrategyOption::costModelSearch: {
+      return std::make_unique<autopas::CostModelSearch>(
+          replay.getContainerOptions(), replay.getCellSizeFactors(), replay.getTraversalOptions(),
+          replay.getDataLayoutOptions(), replay.getNewton3Options(), replay.getVerletSkins(),
+          replay.getVerletRebuildFrequencies(), replay.getNumThreads(), replay.getScheduleOptions(),
+          replay.getScheduleChunkSizes(), replay.getVerletClusterSizes(), maxEvidence);
+    }
+  }
+  return nullptr;
+}
+
+int main(int argc, char *argv[]) {
+  autopas::Logger::create();
+
+  if (argc < 2 or argc > 4) {
+    std::cerr << "Usage: " << argv[0] << " <recordFile> [tuningStrategies] [maxEvidence]" << std::endl
+              << "  tuningStrategies  Comma separated list of strategies to replay. Default: all" << std::endl
+              << "  maxEvidence       Evidence limit for random and bayesian search. Default: 10" << std::endl;
+    return 1;
+  }
+
+  auto strategyOptions = argc > 2 ? autopas::TuningStrategyOption::parseOptions(argv[2])
+                                  : autopas::TuningStrategyOption::getAllOptions();
+  const size_t maxEvidence = argc > 3 ? std::stoul(argv[3]) : 10;
+
+  TuningReplay replay(autopas::TuningRecorder::read(argv[1]));
+  if (replay.getNumConfigurations() == 0) {
+    std::cerr << "No records found in " << argv[1] << std::endl;
+    return 1;
+  }
+  std::cout << "Recorded configurations: " << replay.getNumConfigurations() << std::endl
+            << "Best recorded evidence : " << replay.getBestValue() << " ns" << std::endl
+            << std::endl;
+
+  std::cout << std::setw(20) << std::left << "Strategy" << std::setw(10) << std::right << "Tested" << std::setw(18)
+            << "Tuning cost [ns]" << std::setw(16) << "Regret [ns]" << std::setw(12) << "Regret [%]"
+            << "  Selected configuration" << std::endl;
+  for (auto option : strategyOptions) {
+    std::cout << std::setw(20) << std::left << option.to_string() << std::right;
+    try {
+      auto strategy = generateTuningStrategy(option, replay, maxEvidence);
+      auto result = replay.replay(*strategy);
+      std::cout << std::setw(10) << result.numTested << std::setw(18) << result.tuningCost << std::setw(16)
+                << result.regret << std::setw(12) << std::setprecision(3) << 100. * result.regret / replay.getBestValue()
+                << std::setprecision(6) << "  " << result.optimum.toString()
+                << (result.finished ? "" : " (stopped at step limit)") << std::endl;
+    } catch (const std::exception &e) {
+      std::cout << "  failed: " << e.what() << std::endl;
+    }
+  }
+
+  autopas::Logger::unregister();
+  return 0;
+}